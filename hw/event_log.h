@@ -0,0 +1,87 @@
+#ifndef EVENT_LOG_H
+#define EVENT_LOG_H
+
+#include <stdio.h>
+#include <stdint.h>
+
+#include "spsc_ring.h"
+
+// 이벤트 로그
+// 틱 처리는 형식이 정해진 바이너리 레코드를 링(spsc_ring.h)에 넣기만 하고,
+// 메인 루프가 링을 비우며 format으로 문자열을 만들어 출력 (틱 처리 중에는 stdio/할당/락 없음)
+#define LOG_RING_SIZE 16384     // 링 버퍼 레코드 수 (2의 거듭제곱)
+
+// 출력 수준 (레코드 수준이 설정 수준 이하일 때만 기록)
+enum LogLevel {
+    LOG_QUIET = 0,      // 출력 안 함
+    LOG_LIFECYCLE,      // 도착, 종료, 작업 완료, 에이징 도달, 구분선
+    LOG_DETAIL          // + 디스패치, 퀀텀 만료, I/O 요청/완료
+};
+
+typedef struct {
+    int32_t time;       // 시뮬레이션 시간 (틱)
+    int32_t type;       // 호출자가 정한 이벤트 종류
+    int32_t arg[4];
+} LogRecord;            // 24바이트
+
+typedef void (*LogFormat)(const LogRecord *rec);
+
+typedef struct {
+    SpscRing ring;
+    int level;          // enum LogLevel
+    int open;           // 0 = 링 없음 (LOG_QUIET)
+    LogFormat format;
+} EventLog;
+
+static inline void log_format_record(void *ctx, const void *record) {
+    ((EventLog *)ctx)->format(record);
+}
+
+// level이 LOG_QUIET이면 링을 만들지 않고 log_emit은 아무것도 하지 않음
+static inline void log_open(EventLog *log, int level, int sync, LogFormat format) {
+    log->level = level;
+    log->format = format;
+    log->open = level != LOG_QUIET;
+    if (log->open) {
+        ring_open(&log->ring, sizeof(LogRecord), LOG_RING_SIZE, sync, log_format_record, log);
+    }
+}
+
+// 쌓인 레코드를 순서대로 출력 (메인 루프에서 호출)
+static inline void log_drain(EventLog *log) {
+    if (log->open) {
+        ring_drain(&log->ring);
+    }
+}
+
+static inline void log_emit(EventLog *log, int level, int type, int time, int a0, int a1, int a2, int a3) {
+    if (level > log->level) {
+        return;
+    }
+    LogRecord *rec = ring_reserve(&log->ring);
+    if (rec == NULL) {
+        return;
+    }
+    rec->time = time;
+    rec->type = type;
+    rec->arg[0] = a0;
+    rec->arg[1] = a1;
+    rec->arg[2] = a2;
+    rec->arg[3] = a3;
+    ring_commit(&log->ring);
+}
+
+// 남은 레코드를 출력하고 링 해제
+static inline void log_close(EventLog *log) {
+    if (!log->open) {
+        return;
+    }
+    ring_close(&log->ring);
+    log->open = 0;
+    log->level = LOG_QUIET;
+    if (log->ring.dropped > 0) {
+        printf("[로그] 링이 가득 차 이벤트 %lu개를 버림\n", log->ring.dropped);
+    }
+}
+
+#endif
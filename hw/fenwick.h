@@ -0,0 +1,69 @@
+#ifndef FENWICK_H
+#define FENWICK_H
+
+// 펜윅 트리 (이진 인덱스 트리): 위치별 가중치의 갱신과 누적 합 탐색이 O(log n)
+// tree는 size + 1개짜리 0으로 채운 배열로, 호출자가 할당해 연결 (위치는 0부터)
+typedef struct {
+    long long *tree;
+    int size;
+    int top_bit;            // size 이하의 가장 큰 2의 거듭제곱 (탐색 시작 폭)
+    long long total;
+} Fenwick;
+
+static inline void fw_init(Fenwick *f, long long *tree, int size) {
+    f->tree = tree;
+    f->size = size;
+    f->total = 0;
+    f->top_bit = 1;
+    while (f->top_bit * 2 <= size) {
+        f->top_bit *= 2;
+    }
+}
+
+static inline void fw_add(Fenwick *f, int index, long long delta) {
+    for (int i = index + 1; i <= f->size; i += i & -i) {
+        f->tree[i] += delta;
+    }
+    f->total += delta;
+}
+
+// 앞 count개 위치의 합
+static inline long long fw_prefix(const Fenwick *f, int count) {
+    long long sum = 0;
+
+    for (int i = count; i > 0; i -= i & -i) {
+        sum += f->tree[i];
+    }
+    return sum;
+}
+
+// 크기를 size로 늘림: tree는 호출자가 size + 1개로 재할당해 넘김 (기존 size + 1개는 그대로 보존)
+// 새 노드 j는 구간 (j - lowbit(j), j]의 합인데 늘어난 위치는 아직 0이므로 기존 범위 안의 합(total - 앞부분)만 채움
+static inline void fw_grow(Fenwick *f, long long *tree, int size) {
+    int old_size = f->size;
+
+    f->tree = tree;
+    for (int j = old_size + 1; j <= size; j++) {
+        int from = j - (j & -j);
+        f->tree[j] = from < old_size ? f->total - fw_prefix(f, from) : 0;
+    }
+    f->size = size;
+    while (f->top_bit * 2 <= size) {
+        f->top_bit *= 2;
+    }
+}
+
+// 누적 합이 target을 처음 넘는 위치 (0 <= target < total)
+static inline int fw_find(const Fenwick *f, long long target) {
+    int pos = 0;
+
+    for (int step = f->top_bit; step > 0; step /= 2) {
+        if (pos + step <= f->size && f->tree[pos + step] <= target) {
+            pos += step;
+            target -= f->tree[pos];
+        }
+    }
+    return pos;
+}
+
+#endif
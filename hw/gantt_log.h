@@ -0,0 +1,86 @@
+#ifndef GANTT_LOG_H
+#define GANTT_LOG_H
+
+#include <stdio.h>
+#include <stdlib.h>
+
+// 간트 차트용 런 길이 인코딩 타임라인
+// 프로세스마다 상태가 바뀔 때만 (start, end, state) 구간을 추가하고, 마지막 구간은 끝이 열려 있음
+// 메모리는 프로세스 수 × 시간이 아니라 상태 전환 횟수에 비례하고, 시간 제한 없이 계속 기록 가능
+typedef struct {
+    int start;                  // 구간 시작 틱
+    int end;                    // 구간 마지막 틱 (-1 = 아직 진행 중)
+    int state;                  // 간트 상태 코드 (0=없음, 1=READY, 2=RUNNING, 3=SLEEP)
+} GanttRun;
+
+typedef struct {
+    GanttRun *runs;
+    int count;
+    int capacity;
+} GanttLog;
+
+// time 틱부터 state 상태 (같은 상태가 이어지면 기존 구간을 그대로 연장)
+static inline void gl_record(GanttLog *log, int time, int state) {
+    if (log->count > 0) {
+        GanttRun *last = &log->runs[log->count - 1];
+        if (last->state == state) {
+            return;
+        }
+        if (last->start == time) {
+            // 같은 틱에 상태가 다시 바뀜: 마지막 구간을 덮어쓰고, 직전 구간과 같아지면 합침
+            if (log->count > 1 && log->runs[log->count - 2].state == state) {
+                log->count--;
+                log->runs[log->count - 1].end = -1;
+            } else {
+                last->state = state;
+            }
+            return;
+        }
+        last->end = time - 1;
+    }
+
+    if (log->count == log->capacity) {
+        int capacity = log->capacity > 0 ? log->capacity * 2 : 4;
+        GanttRun *runs = realloc(log->runs, sizeof(GanttRun) * capacity);
+        if (runs == NULL) {
+            perror("간트 로그 할당 실패");
+            exit(1);
+        }
+        log->runs = runs;
+        log->capacity = capacity;
+    }
+    log->runs[log->count].start = time;
+    log->runs[log->count].end = -1;
+    log->runs[log->count].state = state;
+    log->count++;
+}
+
+// time을 포함하는 구간의 인덱스 (기록 전이면 -1), 이진 탐색
+static inline int gl_find(const GanttLog *log, int time) {
+    int lo = 0, hi = log->count - 1, found = -1;
+
+    while (lo <= hi) {
+        int mid = (lo + hi) / 2;
+        if (log->runs[mid].start <= time) {
+            found = mid;
+            lo = mid + 1;
+        } else {
+            hi = mid - 1;
+        }
+    }
+    return found;
+}
+
+// [from, to] 구간의 틱별 상태 코드를 out에 채움 (기록 전 틱은 0)
+static inline void gl_query(const GanttLog *log, int from, int to, int *out) {
+    int run = gl_find(log, from);
+
+    for (int t = from; t <= to; t++) {
+        while (run + 1 < log->count && log->runs[run + 1].start <= t) {
+            run++;
+        }
+        out[t - from] = run >= 0 ? log->runs[run].state : 0;
+    }
+}
+
+#endif
@@ -0,0 +1,189 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "job_stream.h"
+#include "sched_engine.h"
+
+#define SWF_FIELDS 18
+#define SWF_SUBMIT 1            // 0부터 센 필드 번호
+#define SWF_RUN_TIME 3
+
+// 함수 원형
+static void js_advance(JobStream *js);
+static int parse_native(JobStream *js, char *text);
+static int parse_swf(JobStream *js, char *text);
+static void buf_push(JobStream *js, int count, int value);
+
+void js_open(JobStream *js, const char *path, int time_scale) {
+    size_t len = strlen(path);
+
+    memset(js, 0, sizeof(JobStream));
+    js->fp = fopen(path, "r");
+    if (js->fp == NULL) {
+        perror("작업 트레이스 열기 실패");
+        exit(1);
+    }
+    js->format = len >= 4 && strcmp(path + len - 4, ".swf") == 0 ? JOB_FORMAT_SWF : JOB_FORMAT_NATIVE;
+    js->time_scale = time_scale;
+    js->swf_origin = -1;
+    js_advance(js);
+}
+
+// 미리 읽은 작업을 꺼내고 다음 작업을 읽어 둠
+void js_take(JobStream *js, Job *job) {
+    *job = js->next;
+    js->jobs++;
+    js_advance(js);
+}
+
+void js_close(JobStream *js) {
+    if (js->fp != NULL) {
+        fclose(js->fp);
+        js->fp = NULL;
+    }
+    if (js->has_next) {
+        free(js->next.script);
+        js->has_next = 0;
+    }
+    free(js->line);
+    free(js->buf);
+    js->line = NULL;
+    js->buf = NULL;
+}
+
+// 다음 유효한 작업 한 줄을 읽음 (주석/빈 줄은 넘기고 잘못된 줄은 경고 후 건너뜀)
+static void js_advance(JobStream *js) {
+    js->has_next = 0;
+    while (js->fp != NULL && getline(&js->line, &js->line_cap, js->fp) != -1) {
+        char *text = js->line;
+        js->line_no++;
+        while (*text == ' ' || *text == '\t') {
+            text++;
+        }
+        if (*text == '\n' || *text == '\0' || *text == '#' || *text == ';') {
+            continue;
+        }
+
+        int ok = js->format == JOB_FORMAT_SWF ? parse_swf(js, text) : parse_native(js, text);
+        if (!ok) {
+            js->skipped++;
+            continue;
+        }
+        if (js->next.arrival < js->last_arrival) {
+            js->next.arrival = js->last_arrival;
+            js->reordered++;
+        }
+        js->last_arrival = js->next.arrival;
+
+        js->next.script = malloc(sizeof(int) * js->next.length);
+        if (js->next.script == NULL) {
+            perror("작업 스크립트 할당 실패");
+            exit(1);
+        }
+        memcpy(js->next.script, js->buf, sizeof(int) * js->next.length);
+        js->has_next = 1;
+        return;
+    }
+}
+
+// 도착 우선순위 CPU [I/O CPU]...
+static int parse_native(JobStream *js, char *text) {
+    char *end;
+    long values[2];
+    int count = 0;
+
+    for (int k = 0; k < 2; k++) {
+        values[k] = strtol(text, &end, 10);
+        if (end == text) {
+            fprintf(stderr, "작업 트레이스 %lld행: 도착 시간과 우선순위가 필요합니다.\n", js->line_no);
+            return 0;
+        }
+        text = end;
+    }
+    while (1) {
+        long value = strtol(text, &end, 10);
+        if (end == text) {
+            break;
+        }
+        text = end;
+        if (value < 1 || value > INT_MAX / 2) {
+            fprintf(stderr, "작업 트레이스 %lld행: CPU 버스트/I/O 시간은 1 이상이어야 합니다.\n", js->line_no);
+            return 0;
+        }
+        buf_push(js, count++, (int)value);
+    }
+    while (*text == ' ' || *text == '\t' || *text == '\r' || *text == '\n') {
+        text++;
+    }
+    if (*text != '\0' && *text != '#') {
+        fprintf(stderr, "작업 트레이스 %lld행: 숫자가 아닌 값이 있습니다.\n", js->line_no);
+        return 0;
+    }
+    if (values[0] < 0 || values[0] > INT_MAX / 2 || count % 2 == 0) {
+        fprintf(stderr, "작업 트레이스 %lld행: 도착 시간은 0 이상, 마지막은 CPU 버스트여야 합니다.\n", js->line_no);
+        return 0;
+    }
+
+    js->next.arrival = (int)values[0];
+    js->next.priority = values[1] < MIN_PRIORITY ? MIN_PRIORITY : values[1] > MAX_PRIORITY ? MAX_PRIORITY : (int)values[1];
+    js->next.length = count;
+    return 1;
+}
+
+// SWF 한 줄: 제출 시간과 실행 시간만 사용 (실행 시간이 없는(-1) 작업은 건너뜀)
+static int parse_swf(JobStream *js, char *text) {
+    double fields[SWF_FIELDS];
+    char *end;
+    int count = 0;
+
+    while (count < SWF_FIELDS) {
+        fields[count] = strtod(text, &end);
+        if (end == text) {
+            break;
+        }
+        text = end;
+        count++;
+    }
+    if (count <= SWF_RUN_TIME) {
+        fprintf(stderr, "작업 트레이스 %lld행: SWF 필드가 부족합니다.\n", js->line_no);
+        return 0;
+    }
+    long long submit = (long long)fields[SWF_SUBMIT];
+    long long run_time = (long long)fields[SWF_RUN_TIME];
+    if (submit < 0 || run_time <= 0) {
+        return 0;
+    }
+    if (js->swf_origin == -1) {
+        js->swf_origin = submit;
+    }
+
+    long long arrival = (submit - js->swf_origin) / js->time_scale;
+    long long burst = (run_time + js->time_scale - 1) / js->time_scale;
+    if (arrival < 0) {
+        arrival = 0;    // 첫 작업보다 먼저 제출된 작업 (js_advance가 순서를 맞춤)
+    }
+    if (arrival > INT_MAX / 2 || burst > INT_MAX / 2) {
+        fprintf(stderr, "작업 트레이스 %lld행: 시간이 너무 큽니다 (-T로 틱 단위를 키우세요).\n", js->line_no);
+        return 0;
+    }
+    buf_push(js, 0, (int)burst);
+    js->next.arrival = (int)arrival;
+    js->next.priority = (MIN_PRIORITY + MAX_PRIORITY) / 2;
+    js->next.length = 1;
+    return 1;
+}
+
+static void buf_push(JobStream *js, int count, int value) {
+    if (count == js->buf_cap) {
+        int capacity = js->buf_cap > 0 ? js->buf_cap * 2 : 16;
+        int *buf = realloc(js->buf, sizeof(int) * capacity);
+        if (buf == NULL) {
+            perror("작업 스크립트 버퍼 할당 실패");
+            exit(1);
+        }
+        js->buf = buf;
+        js->buf_cap = capacity;
+    }
+    js->buf[count] = value;
+}
@@ -0,0 +1,53 @@
+#ifndef JOB_STREAM_H
+#define JOB_STREAM_H
+
+#include <stdio.h>
+
+// 작업 트레이스 스트림: 파일에서 도착 시간 순으로 작업을 한 줄씩 읽어 공급
+// 미리 읽어 두는 것은 다음 작업 하나뿐이라 트레이스 길이와 관계없이 메모리 사용량이 일정
+// - 기본 형식 (한 줄 = 작업 하나, '#' 주석): 도착 우선순위 CPU [I/O CPU]...
+//   CPU 버스트와 I/O 시간(틱)이 번갈아 나오고 CPU 버스트로 끝남 (마지막 버스트 후 종료)
+// - SWF (Standard Workload Format, ';' 주석, 확장자 .swf): 필드 2 = 제출 시간, 필드 4 = 실행 시간 (초)
+//   첫 작업의 제출 시간을 0으로 맞추고 time_scale초를 1틱으로 환산, I/O 없이 버스트 하나로 실행
+enum JobFormat {
+    JOB_FORMAT_NATIVE,
+    JOB_FORMAT_SWF
+};
+
+typedef struct {
+    int arrival;            // 도착 시간 (틱)
+    int priority;
+    int length;             // script 길이 (홀수)
+    int *script;            // CPU, I/O, CPU, ..., CPU (js_take로 꺼내면 호출자가 해제)
+} Job;
+
+typedef struct {
+    FILE *fp;
+    enum JobFormat format;
+    int time_scale;         // SWF: 1틱 = time_scale초
+    char *line;             // getline 버퍼
+    size_t line_cap;
+    int *buf;               // 한 줄을 파싱하는 동안의 스크립트 버퍼
+    int buf_cap;
+    Job next;               // 미리 읽은 다음 작업 (has_next = 0이면 끝)
+    int has_next;
+    long long line_no;
+    long long swf_origin;   // SWF 첫 작업의 제출 시간 (-1 = 아직 없음)
+    int last_arrival;
+
+    // 통계
+    long long jobs;         // 공급한 작업 수
+    long long skipped;      // 형식 오류/실행 시간 없음으로 건너뛴 줄
+    long long reordered;    // 도착 시간이 앞 작업보다 빨라 앞 작업 시간으로 맞춘 작업
+} JobStream;
+
+void js_open(JobStream *js, const char *path, int time_scale);
+void js_take(JobStream *js, Job *job);
+void js_close(JobStream *js);
+
+// 다음 작업의 도착 시간 (-1 = 더 없음)
+static inline int js_peek(const JobStream *js) {
+    return js->has_next ? js->next.arrival : -1;
+}
+
+#endif
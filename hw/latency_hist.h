@@ -0,0 +1,105 @@
+#ifndef LATENCY_HIST_H
+#define LATENCY_HIST_H
+
+#include <stdio.h>
+
+// 로그-선형 지연 히스토그램 (HDR 히스토그램 방식, 단위 나노초)
+// 2의 거듭제곱 구간마다 HIST_SUB_COUNT칸으로 나눠 상대 오차 1/HIST_SUB_COUNT 이내로 세므로
+// 수십 ns부터 수 분까지 고정 크기 배열 하나로 꼬리 지연(p99, p99.9)을 볼 수 있음 (기록은 할당 없이 O(1))
+// 0..HIST_SUB_COUNT-1은 1ns 단위, 2^HIST_MAX_BITS 이상은 마지막 칸에 넣음
+#define HIST_SUB_BITS 5
+#define HIST_SUB_COUNT (1 << HIST_SUB_BITS)
+#define HIST_MAX_BITS 40        // 2^40ns ≈ 18분
+#define HIST_BUCKETS ((HIST_MAX_BITS - HIST_SUB_BITS + 1) * HIST_SUB_COUNT)
+
+typedef struct {
+    long long counts[HIST_BUCKETS];
+    long long total;
+    long long min;
+    long long max;
+    double sum;
+} LatencyHist;
+
+static inline int hist_index(long long value) {
+    if (value < HIST_SUB_COUNT) {
+        return value < 0 ? 0 : (int)value;
+    }
+    int msb = 63 - __builtin_clzll((unsigned long long)value);
+    if (msb >= HIST_MAX_BITS) {
+        return HIST_BUCKETS - 1;
+    }
+    int shift = msb - HIST_SUB_BITS;
+    return (shift + 1) * HIST_SUB_COUNT + (int)((value >> shift) - HIST_SUB_COUNT);
+}
+
+// 칸이 나타내는 값 범위 [하한, 하한 + 폭)
+static inline long long hist_lower(int index) {
+    if (index < HIST_SUB_COUNT) {
+        return index;
+    }
+    int shift = index / HIST_SUB_COUNT - 1;
+    return (long long)(HIST_SUB_COUNT + index % HIST_SUB_COUNT) << shift;
+}
+
+static inline long long hist_width(int index) {
+    return index < HIST_SUB_COUNT ? 1 : 1LL << (index / HIST_SUB_COUNT - 1);
+}
+
+static inline void hist_record(LatencyHist *h, long long value) {
+    if (value < 0) {
+        value = 0;
+    }
+    h->counts[hist_index(value)]++;
+    if (h->total == 0 || value < h->min) {
+        h->min = value;
+    }
+    if (value > h->max) {
+        h->max = value;
+    }
+    h->total++;
+    h->sum += value;
+}
+
+// 백분위 (0..100) 값: 해당 칸의 상한 (실제 최대값을 넘지 않게)
+static inline long long hist_percentile(const LatencyHist *h, double percentile) {
+    long long rank = (long long)(percentile / 100.0 * h->total + 0.5);
+    long long seen = 0;
+
+    if (h->total == 0) {
+        return 0;
+    }
+    if (rank < 1) {
+        rank = 1;
+    }
+    for (int i = 0; i < HIST_BUCKETS; i++) {
+        seen += h->counts[i];
+        if (seen >= rank) {
+            long long upper = hist_lower(i) + hist_width(i) - 1;
+            return upper < h->max ? upper : h->max;
+        }
+    }
+    return h->max;
+}
+
+// 한 줄 요약 (마이크로초, name은 호출자가 표 너비에 맞춤)
+static inline void hist_print(const char *name, const LatencyHist *h) {
+    if (h->total == 0) {
+        printf("%s 표본 없음\n", name);
+        return;
+    }
+    printf("%s %8lld %10.1f %9.1f %9.1f %9.1f %9.1f %9.1f %10.1f\n", name, h->total,
+           h->sum / h->total / 1000.0, h->min / 1000.0, hist_percentile(h, 50) / 1000.0,
+           hist_percentile(h, 90) / 1000.0, hist_percentile(h, 99) / 1000.0,
+           hist_percentile(h, 99.9) / 1000.0, h->max / 1000.0);
+}
+
+// 비어 있지 않은 칸을 CSV 행으로 (이름,하한ns,상한ns,개수)
+static inline void hist_export(FILE *out, const char *name, const LatencyHist *h) {
+    for (int i = 0; i < HIST_BUCKETS; i++) {
+        if (h->counts[i] > 0) {
+            fprintf(out, "%s,%lld,%lld,%lld\n", name, hist_lower(i), hist_lower(i) + hist_width(i) - 1, h->counts[i]);
+        }
+    }
+}
+
+#endif
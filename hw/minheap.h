@@ -0,0 +1,99 @@
+#ifndef MINHEAP_H
+#define MINHEAP_H
+
+// 인덱스 기반 이진 최소 힙 (원소 = 프로세스 인덱스, 키 = key[index], 같은 키는 인덱스 순)
+// heap/key는 프로세스 수만큼의 배열로, 호출자가 할당해 연결 (PCB 저장소의 열)
+// 각 프로세스는 힙에 최대 한 번만 들어가므로 heap 열 크기면 충분, 삽입/삭제 O(log n)이고 할당 없음
+typedef struct {
+    int *heap;
+    int count;
+    long long *key;
+} MinHeap;
+
+static inline void mh_init(MinHeap *h) {
+    h->count = 0;
+}
+
+// a가 b보다 앞이면 1
+static inline int mh_less(const MinHeap *h, int a, int b) {
+    return h->key[a] < h->key[b] || (h->key[a] == h->key[b] && a < b);
+}
+
+// 최소 키 원소 (비어있으면 -1, O(1))
+static inline int mh_top(const MinHeap *h) {
+    return h->count > 0 ? h->heap[0] : -1;
+}
+
+// 빈 자리 pos에서 index가 들어갈 곳까지 부모를 끌어내림
+static inline void mh_sift_up(MinHeap *h, int pos, int index) {
+    while (pos > 0) {
+        int parent = (pos - 1) / 2;
+        if (!mh_less(h, index, h->heap[parent])) {
+            break;
+        }
+        h->heap[pos] = h->heap[parent];
+        pos = parent;
+    }
+    h->heap[pos] = index;
+}
+
+// 빈 자리 pos에서 index가 들어갈 곳까지 작은 자식을 끌어올림
+static inline void mh_sift_down(MinHeap *h, int pos, int index) {
+    while (1) {
+        int child = pos * 2 + 1;
+        if (child >= h->count) {
+            break;
+        }
+        if (child + 1 < h->count && mh_less(h, h->heap[child + 1], h->heap[child])) {
+            child++;
+        }
+        if (!mh_less(h, h->heap[child], index)) {
+            break;
+        }
+        h->heap[pos] = h->heap[child];
+        pos = child;
+    }
+    h->heap[pos] = index;
+}
+
+// key[index]를 먼저 채운 뒤 호출
+static inline void mh_push(MinHeap *h, int index) {
+    mh_sift_up(h, h->count++, index);
+}
+
+// 최소 키 원소를 꺼냄 (비어있으면 -1)
+static inline int mh_pop(MinHeap *h) {
+    if (h->count == 0) {
+        return -1;
+    }
+    int top = h->heap[0];
+    int last = h->heap[--h->count];
+
+    if (h->count > 0) {
+        mh_sift_down(h, 0, last);
+    }
+    return top;
+}
+
+// 중간 원소 제거 (외부 종료처럼 드문 경로용: 위치 열을 두지 않으므로 찾는 데 O(n), 없으면 아무것도 안 함)
+static inline void mh_remove(MinHeap *h, int index) {
+    int pos = 0;
+
+    while (pos < h->count && h->heap[pos] != index) {
+        pos++;
+    }
+    if (pos == h->count) {
+        return;
+    }
+    int last = h->heap[--h->count];
+    if (pos == h->count) {
+        return;
+    }
+    if (pos > 0 && mh_less(h, last, h->heap[(pos - 1) / 2])) {
+        mh_sift_up(h, pos, last);
+    } else {
+        mh_sift_down(h, pos, last);
+    }
+}
+
+#endif
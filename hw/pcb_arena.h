@@ -0,0 +1,77 @@
+#ifndef PCB_ARENA_H
+#define PCB_ARENA_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// PCB 저장소용 열(column) 아레나
+// PCB를 구조체 배열 대신 필드별 배열(SoA)로 두고, 모든 열을 하나의 메모리 블록에서 잘라 씀
+// 용량이 부족하면 두 배 크기의 블록을 새로 잡아 기존 내용을 복사 (열 포인터 변수도 갱신)
+// 틱마다 훑는 핫 필드는 각자 연속 배열이 되고, 통계용 콜드 필드는 별도 구조체 배열로 분리
+#define ARENA_MAX_COLUMNS 32
+#define ARENA_ALIGN 64              // 열마다 캐시 라인 경계에서 시작
+
+typedef struct {
+    void **columns[ARENA_MAX_COLUMNS];  // 열 포인터 변수의 주소
+    size_t elem_sizes[ARENA_MAX_COLUMNS];
+    int num_columns;
+    int capacity;                       // 열마다 담을 수 있는 원소 수
+    char *block;
+} PCBArena;
+
+// 열 등록 (column_ptr = 배열 포인터 변수의 주소, 예: &pcb_state)
+static inline void arena_column(PCBArena *arena, void *column_ptr, size_t elem_size) {
+    if (arena->num_columns == ARENA_MAX_COLUMNS) {
+        fprintf(stderr, "아레나 열 개수 초과\n");
+        exit(1);
+    }
+    arena->columns[arena->num_columns] = (void **)column_ptr;
+    arena->elem_sizes[arena->num_columns] = elem_size;
+    arena->num_columns++;
+    *(void **)column_ptr = NULL;
+}
+
+static inline size_t arena_column_bytes(size_t elem_size, int capacity) {
+    size_t bytes = elem_size * (size_t)capacity;
+    return (bytes + ARENA_ALIGN - 1) / ARENA_ALIGN * ARENA_ALIGN;
+}
+
+// 최소 capacity개를 담도록 확장 (두 배씩 증가, 기존 원소 보존)
+static inline void arena_reserve(PCBArena *arena, int capacity) {
+    if (capacity <= arena->capacity) {
+        return;
+    }
+
+    int new_capacity = arena->capacity > 0 ? arena->capacity * 2 : 16;
+    while (new_capacity < capacity) {
+        new_capacity *= 2;
+    }
+
+    size_t total = 0;
+    for (int c = 0; c < arena->num_columns; c++) {
+        total += arena_column_bytes(arena->elem_sizes[c], new_capacity);
+    }
+
+    char *block = NULL;
+    if (posix_memalign((void **)&block, ARENA_ALIGN, total) != 0) {
+        perror("PCB 아레나 할당 실패");
+        exit(1);
+    }
+
+    size_t offset = 0;
+    for (int c = 0; c < arena->num_columns; c++) {
+        char *column = block + offset;
+        if (*arena->columns[c] != NULL) {
+            memcpy(column, *arena->columns[c], arena->elem_sizes[c] * (size_t)arena->capacity);
+        }
+        *arena->columns[c] = column;
+        offset += arena_column_bytes(arena->elem_sizes[c], new_capacity);
+    }
+
+    free(arena->block);
+    arena->block = block;
+    arena->capacity = new_capacity;
+}
+
+#endif
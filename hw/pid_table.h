@@ -0,0 +1,104 @@
+#ifndef PID_TABLE_H
+#define PID_TABLE_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/types.h>
+
+// pid → PCB 인덱스 해시 테이블 (오픈 어드레싱, 선형 탐사)
+// fork 직후 부모가 등록하고 자식을 회수할 때 O(1)로 조회 (pidfd 없이 SIGCHLD로 회수하는 경우)
+typedef struct {
+    pid_t *keys;                // 0 = 빈 칸
+    int *values;
+    unsigned int mask;          // 용량 - 1 (용량은 2의 거듭제곱)
+} PidTable;
+
+static inline unsigned int pt_hash(pid_t pid) {
+    return (unsigned int)pid * 2654435761u;  // Knuth 곱셈 해시
+}
+
+// 최대 max_entries개를 적재율 50% 이하로 담을 수 있게 할당
+static inline void pt_init(PidTable *pt, int max_entries) {
+    unsigned int capacity = 16;
+    while (capacity < (unsigned int)max_entries * 2) {
+        capacity <<= 1;
+    }
+    pt->keys = calloc(capacity, sizeof(pid_t));
+    pt->values = malloc(sizeof(int) * capacity);
+    if (pt->keys == NULL || pt->values == NULL) {
+        perror("pid 테이블 할당 실패");
+        exit(1);
+    }
+    pt->mask = capacity - 1;
+}
+
+static inline void pt_insert(PidTable *pt, pid_t pid, int index) {
+    unsigned int slot = pt_hash(pid) & pt->mask;
+
+    while (pt->keys[slot] != 0 && pt->keys[slot] != pid) {
+        slot = (slot + 1) & pt->mask;
+    }
+    pt->keys[slot] = pid;
+    pt->values[slot] = index;
+}
+
+// max_entries개까지 적재율 50% 이하가 되도록 필요하면 키워서 재해시
+// (PCB 저장소를 늘릴 때 함께 호출)
+static inline void pt_reserve(PidTable *pt, int max_entries) {
+    if ((unsigned int)max_entries * 2 <= pt->mask + 1) {
+        return;
+    }
+
+    PidTable old = *pt;
+    pt_init(pt, max_entries);
+    for (unsigned int slot = 0; slot <= old.mask; slot++) {
+        if (old.keys[slot] != 0) {
+            pt_insert(pt, old.keys[slot], old.values[slot]);
+        }
+    }
+    free(old.keys);
+    free(old.values);
+}
+
+// 없으면 -1
+static inline int pt_lookup(const PidTable *pt, pid_t pid) {
+    unsigned int slot = pt_hash(pid) & pt->mask;
+
+    while (pt->keys[slot] != 0) {
+        if (pt->keys[slot] == pid) {
+            return pt->values[slot];
+        }
+        slot = (slot + 1) & pt->mask;
+    }
+    return -1;
+}
+
+// 삭제 후 뒤따르는 항목을 당겨 탐사 사슬 유지 (툼스톤 없음)
+static inline void pt_remove(PidTable *pt, pid_t pid) {
+    unsigned int slot = pt_hash(pid) & pt->mask;
+
+    while (pt->keys[slot] != pid) {
+        if (pt->keys[slot] == 0) {
+            return;
+        }
+        slot = (slot + 1) & pt->mask;
+    }
+
+    unsigned int hole = slot;
+    for (;;) {
+        slot = (slot + 1) & pt->mask;
+        if (pt->keys[slot] == 0) {
+            break;
+        }
+        // slot 항목의 원래 위치가 (hole, slot] 범위 밖이면 hole로 이동
+        unsigned int home = pt_hash(pt->keys[slot]) & pt->mask;
+        if (((slot - home) & pt->mask) >= ((slot - hole) & pt->mask)) {
+            pt->keys[hole] = pt->keys[slot];
+            pt->values[hole] = pt->values[slot];
+            hole = slot;
+        }
+    }
+    pt->keys[hole] = 0;
+}
+
+#endif
@@ -0,0 +1,318 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "sched_engine.h"
+#include "rbtree.h"
+
+// CFS (Completely Fair Scheduler) 방식
+// - 실행한 틱을 nice 가중치로 나눈 가상 실행 시간(vruntime)을 누적
+// - READY 프로세스는 vruntime 순 레드-블랙 트리에 두고 가장 왼쪽(최소 vruntime)을 O(log n)으로 선택
+// - 타임 슬라이스 = 타겟 지연 × (내 가중치 / 실행 가능한 가중치 합), 최소 MIN_GRANULARITY틱
+// - I/O에서 깨어나면 vruntime을 min_vruntime - SLEEPER_CREDIT까지만 당겨 줌 (잠든 동안의 보상 제한)
+// - 다중 CPU면 CPU마다 트리/min_vruntime을 두고, 다른 CPU로 옮겨 갈 때는 vruntime을 원래 CPU의
+//   min_vruntime 기준 상대값으로 바꿨다가 새 CPU의 min_vruntime에 더함 (리눅스 migrate_task_rq_fair와 같은 정규화)
+#define NICE_0_LOAD 1024
+#define VR_SHIFT 20                 // nice 0 프로세스의 1틱 = 1 << VR_SHIFT vruntime
+#define MIN_GRANULARITY 1           // 최소 타임 슬라이스 (틱)
+#define LATENCY_PER_QUANTUM 2       // 타겟 지연 = 2 × 타임 퀀텀 (틱)
+#define COST_SAMPLE_MASK 63         // 선택/삽입 비용은 64번에 한 번만 잼 (매번 clock_gettime을 부르지 않음)
+
+// nice -20..19 → 가중치 (리눅스 sched_prio_to_weight, nice 1 차이마다 약 1.25배)
+static const int nice_to_weight[40] = {
+    88761, 71755, 56483, 46273, 36291,
+    29154, 23254, 18705, 14949, 11916,
+    9548, 7620, 6100, 4904, 3906,
+    3121, 2501, 1991, 1586, 1277,
+    1024, 820, 655, 526, 423,
+    335, 272, 215, 172, 137,
+    110, 87, 70, 56, 45,
+    36, 29, 23, 18, 15,
+};
+
+// CPU별 런 큐
+typedef struct {
+    RBTree tree;                // 키 = vruntime (열 포인터는 CfsState.columns에서 복사)
+    long long tree_weight;      // 트리에 있는 프로세스의 가중치 합
+    long long min_vruntime;     // 단조 증가하는 최소 vruntime (새 프로세스/깨어난 프로세스 배치 기준)
+} CfsRq;
+
+typedef struct {
+    RBTree columns;             // 모든 CPU 트리가 공유하는 노드 열 (PCB 저장소의 열, 아레나가 갱신)
+    CfsRq *rqs;
+    int *weight;
+    int *charged_ticks;         // vruntime에 이미 반영한 실행 틱
+    unsigned char *migrated;    // 1 = vruntime이 원래 CPU의 min_vruntime 기준 상대값
+    int latency;                // 타겟 지연 (틱)
+
+    // 통계 (비용은 표본으로 잰 호출만 합산)
+    long long pick_ns;
+    long long pick_count;
+    long long pick_samples;
+    long long enqueue_ns;
+    long long enqueue_count;
+    long long enqueue_samples;
+    int max_tree;
+    long long spread_sum;       // 선택 시점마다 트리 안 vruntime 편차 (최대 - 최소) 합
+    long long spread_max;
+} CfsState;
+
+// 작업 부하 우선순위 0..10 → nice -10..10 (우선순위 한 단계 = nice 2)
+static int priority_to_nice(int priority) {
+    return (priority - (MIN_PRIORITY + MAX_PRIORITY) / 2) * 2;
+}
+
+static long long now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000000000LL + ts.tv_nsec;
+}
+
+static void cfs_init(Sim *sim) {
+    CfsState *cs = calloc(1, sizeof(CfsState));
+    if (cs == NULL) {
+        perror("정책 상태 할당 실패");
+        exit(1);
+    }
+    cs->rqs = calloc(sim->num_cpus, sizeof(CfsRq));
+    if (cs->rqs == NULL) {
+        perror("정책 상태 할당 실패");
+        exit(1);
+    }
+    for (int cpu = 0; cpu < sim->num_cpus; cpu++) {
+        rb_init(&cs->rqs[cpu].tree);
+    }
+    cs->latency = LATENCY_PER_QUANTUM * sim->config.time_quantum;
+    arena_column(&sim->arena, &cs->columns.left, sizeof(int));
+    arena_column(&sim->arena, &cs->columns.right, sizeof(int));
+    arena_column(&sim->arena, &cs->columns.parent, sizeof(int));
+    arena_column(&sim->arena, &cs->columns.color, sizeof(unsigned char));
+    arena_column(&sim->arena, &cs->columns.key, sizeof(long long));
+    arena_column(&sim->arena, &cs->weight, sizeof(int));
+    arena_column(&sim->arena, &cs->charged_ticks, sizeof(int));
+    arena_column(&sim->arena, &cs->migrated, sizeof(unsigned char));
+    sim->policy_data = cs;
+}
+
+// cpu의 런 큐 (아레나가 커지면 열 주소가 바뀌므로 쓰기 전에 트리의 열 포인터를 맞춤)
+static CfsRq *cpu_rq(CfsState *cs, int cpu) {
+    CfsRq *rq = &cs->rqs[cpu];
+
+    rq->tree.left = cs->columns.left;
+    rq->tree.right = cs->columns.right;
+    rq->tree.parent = cs->columns.parent;
+    rq->tree.color = cs->columns.color;
+    rq->tree.key = cs->columns.key;
+    return rq;
+}
+
+// 마지막 반영 이후 실행한 틱을 가중치로 나눠 vruntime에 더함
+static void charge(Sim *sim, CfsState *cs, int index) {
+    int delta = sim->pcb_run_ticks[index] - cs->charged_ticks[index];
+
+    if (delta > 0) {
+        cs->columns.key[index] += ((long long)delta << VR_SHIFT) * NICE_0_LOAD / cs->weight[index];
+        cs->charged_ticks[index] = sim->pcb_run_ticks[index];
+    }
+}
+
+// min_vruntime = max(이전 값, min(트리 최소, 실행 중 프로세스))
+static void update_min_vruntime(Sim *sim, CfsState *cs, CfsRq *rq, int cpu) {
+    int curr = sim->cpus[cpu].current;
+    long long vruntime = rq->min_vruntime;
+    int found = 0;
+
+    if (curr != -1 && sim->pcb_state[curr] == RUNNING) {
+        charge(sim, cs, curr);
+        vruntime = rq->tree.key[curr];
+        found = 1;
+    }
+    if (rq->tree.leftmost != -1) {
+        long long left = rq->tree.key[rq->tree.leftmost];
+        if (!found || left < vruntime) {
+            vruntime = left;
+        }
+        found = 1;
+    }
+    if (found && vruntime > rq->min_vruntime) {
+        rq->min_vruntime = vruntime;
+    }
+}
+
+// 새 프로세스: nice로 가중치를 정하고 현재 min_vruntime에서 시작
+static void cfs_admit(Sim *sim, int index) {
+    CfsState *cs = sim->policy_data;
+    int nice = priority_to_nice(sim->pcb_cold[index].initial_priority);
+
+    cs->weight[index] = nice_to_weight[nice + 20];
+    cs->charged_ticks[index] = 0;
+    cs->migrated[index] = 0;
+    cs->columns.key[index] = cs->rqs[sim->pcb_cpu[index]].min_vruntime;
+}
+
+static void cfs_enqueue(Sim *sim, int index) {
+    CfsState *cs = sim->policy_data;
+    int sampled = (cs->enqueue_count++ & COST_SAMPLE_MASK) == 0;
+    long long begin = sampled ? now_ns() : 0;
+    int cpu = sim->pcb_cpu[index];
+    CfsRq *rq = cpu_rq(cs, cpu);
+
+    charge(sim, cs, index);
+    if (cs->migrated[index]) {
+        rq->tree.key[index] += rq->min_vruntime;
+        cs->migrated[index] = 0;
+    }
+    rb_insert(&rq->tree, index);
+    rq->tree_weight += cs->weight[index];
+    if (rq->tree.count > cs->max_tree) {
+        cs->max_tree = rq->tree.count;
+    }
+    update_min_vruntime(sim, cs, rq, cpu);
+
+    if (sampled) {
+        cs->enqueue_ns += now_ns() - begin;
+        cs->enqueue_samples++;
+    }
+}
+
+// 가장 왼쪽(최소 vruntime)을 꺼내고 가중치 비율만큼 타임 슬라이스 부여
+static int cfs_pick_next(Sim *sim) {
+    CfsState *cs = sim->policy_data;
+    CfsRq *rq = cpu_rq(cs, sim->current_cpu);
+    int index = rq->tree.leftmost;
+
+    if (index == -1) {
+        return -1;
+    }
+    int sampled = (cs->pick_count++ & COST_SAMPLE_MASK) == 0;
+    long long begin = sampled ? now_ns() : 0;
+    int nr_running = rq->tree.count;    // 꺼내기 전 = 이 프로세스 포함 실행 가능 수
+    long long spread = rq->tree.key[rb_last(&rq->tree)] - rq->tree.key[index];
+    cs->spread_sum += spread;
+    if (spread > cs->spread_max) {
+        cs->spread_max = spread;
+    }
+    long long total_weight = rq->tree_weight;
+    rb_erase(&rq->tree, index);
+    rq->tree_weight -= cs->weight[index];
+
+    // 실행 가능한 프로세스가 많으면 타겟 지연을 늘려 슬라이스가 최소 단위 아래로 내려가지 않게 함
+    long long latency = cs->latency;
+    if ((long long)nr_running * MIN_GRANULARITY > latency) {
+        latency = (long long)nr_running * MIN_GRANULARITY;
+    }
+    long long slice = latency * cs->weight[index] / total_weight;
+    if (slice < MIN_GRANULARITY) {
+        slice = MIN_GRANULARITY;
+    }
+    sim->pcb_remaining_quantum[index] = (int)slice;
+
+    if (sampled) {
+        cs->pick_ns += now_ns() - begin;
+        cs->pick_samples++;
+    }
+    return index;
+}
+
+static void cfs_remove(Sim *sim, int index) {
+    CfsState *cs = sim->policy_data;
+    CfsRq *rq = cpu_rq(cs, sim->pcb_cpu[index]);
+
+    rb_erase(&rq->tree, index);
+    rq->tree_weight -= cs->weight[index];
+}
+
+// 다른 CPU로 옮길 프로세스: vruntime이 가장 큰(가장 오래 기다려도 되는) 오른쪽 끝을 내줌
+static int cfs_steal(Sim *sim, int cpu) {
+    CfsState *cs = sim->policy_data;
+    CfsRq *rq = cpu_rq(cs, cpu);
+
+    if (rq->tree.count == 0) {
+        return -1;
+    }
+    int index = rb_last(&rq->tree);
+    rb_erase(&rq->tree, index);
+    rq->tree_weight -= cs->weight[index];
+    rq->tree.key[index] -= rq->min_vruntime;
+    cs->migrated[index] = 1;
+    return index;
+}
+
+// 잠든 동안 vruntime이 멈춰 있으므로 깨어날 때 min_vruntime - SLEEPER_CREDIT 아래면 끌어올림
+// (보상을 타겟 지연의 절반으로 제한해 오래 잔 프로세스가 CPU를 독점하지 않게 함)
+static void cfs_on_io_complete(Sim *sim, int index) {
+    CfsState *cs = sim->policy_data;
+    long long credit = ((long long)cs->latency << VR_SHIFT) / 2;
+    int cpu = sim->pcb_cpu[index];
+    CfsRq *rq = cpu_rq(cs, cpu);
+
+    charge(sim, cs, index);
+    update_min_vruntime(sim, cs, rq, cpu);
+    if (rq->tree.key[index] < rq->min_vruntime - credit) {
+        rq->tree.key[index] = rq->min_vruntime - credit;
+    }
+}
+
+// 공정성: 선택 시점의 vruntime 편차와 nice별 CPU 점유율 (실행 / (실행 + 대기))
+// 편차가 작게 유지되면 실행 가능한 프로세스들이 가중치에 비례해 CPU를 나눠 받고 있다는 뜻
+static void cfs_print_stats(Sim *sim) {
+    CfsState *cs = sim->policy_data;
+    int levels = MAX_PRIORITY - MIN_PRIORITY + 1;
+    long long run[MAX_PRIORITY - MIN_PRIORITY + 1] = {0};
+    long long wait[MAX_PRIORITY - MIN_PRIORITY + 1] = {0};
+    int count[MAX_PRIORITY - MIN_PRIORITY + 1] = {0};
+
+    for (int i = 0; i < sim->num_processes; i++) {
+        int level = sim->pcb_cold[i].initial_priority - MIN_PRIORITY;
+        run[level] += sim->pcb_run_ticks[i];
+        wait[level] += sim_wait_time(sim, i);
+        count[level]++;
+    }
+
+    printf("\n[CFS] 타겟 지연: %d틱, 최소 슬라이스: %d틱, 잠에서 깬 보상: %d틱\n",
+           cs->latency, MIN_GRANULARITY, cs->latency / 2);
+    if (cs->pick_count > 0) {
+        printf("[CFS] vruntime 편차 (nice 0 기준 틱): 평균 %.2f, 최대 %.2f\n",
+               (double)cs->spread_sum / cs->pick_count / (1LL << VR_SHIFT),
+               (double)cs->spread_max / (1LL << VR_SHIFT));
+    }
+    printf("[CFS]  nice   가중치  프로세스  평균 실행  평균 대기  CPU 점유율\n");
+    for (int level = 0; level < levels; level++) {
+        if (count[level] == 0) {
+            continue;
+        }
+        int nice = priority_to_nice(level + MIN_PRIORITY);
+        printf("[CFS] %5d %8d %9d %10.1f %10.1f %10.4f\n",
+               nice, nice_to_weight[nice + 20], count[level],
+               (double)run[level] / count[level], (double)wait[level] / count[level],
+               run[level] + wait[level] > 0 ? (double)run[level] / (run[level] + wait[level]) : 0.0);
+    }
+    printf("[CFS] 최대 트리 크기: %d\n", cs->max_tree);
+    if (cs->pick_samples > 0 && cs->enqueue_samples > 0) {
+        printf("[CFS] 평균 선택 비용: %.0f ns (%lld회), 평균 삽입 비용: %.0f ns (%lld회, %d번에 한 번 측정)\n",
+               (double)cs->pick_ns / cs->pick_samples, cs->pick_count,
+               (double)cs->enqueue_ns / cs->enqueue_samples, cs->enqueue_count, COST_SAMPLE_MASK + 1);
+    }
+}
+
+static void cfs_destroy(Sim *sim) {
+    CfsState *cs = sim->policy_data;
+
+    free(cs->rqs);
+    free(cs);
+}
+
+const Policy cfs_policy = {
+    .name = "cfs",
+    .title = "CFS (vruntime)",
+    .uses_quantum = 1,
+    .init = cfs_init,
+    .admit = cfs_admit,
+    .enqueue = cfs_enqueue,
+    .pick_next = cfs_pick_next,
+    .remove = cfs_remove,
+    .steal = cfs_steal,
+    .on_io_complete = cfs_on_io_complete,
+    .print_stats = cfs_print_stats,
+    .destroy = cfs_destroy,
+};
@@ -0,0 +1,93 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "sched_engine.h"
+#include "minheap.h"
+
+// EDF (Earliest Deadline First)
+// - READY 프로세스를 현재 작업의 절대 데드라인 순 최소 힙에 두고 가장 이른 데드라인을 선택
+// - 실행 중인 작업보다 데드라인이 이른 작업이 릴리스되면 이번 틱 끝에 선점
+// - 데드라인이 없는 일반 프로세스(INT_MAX)는 실시간 작업이 없을 때만 인덱스 순으로 실행
+typedef struct {
+    MinHeap heap;               // 키 = 절대 데드라인 (PCB 저장소의 열)
+    long long preemptions;
+    int max_heap;
+} EdfState;
+
+static void edf_init(Sim *sim) {
+    EdfState *es = calloc(1, sizeof(EdfState));
+    if (es == NULL) {
+        perror("정책 상태 할당 실패");
+        exit(1);
+    }
+    mh_init(&es->heap);
+    arena_column(&sim->arena, &es->heap.heap, sizeof(int));
+    arena_column(&sim->arena, &es->heap.key, sizeof(long long));
+    sim->policy_data = es;
+}
+
+static void edf_enqueue(Sim *sim, int index) {
+    EdfState *es = sim->policy_data;
+
+    es->heap.key[index] = sim->pcb_deadline[index];
+    mh_push(&es->heap, index);
+    if (es->heap.count > es->max_heap) {
+        es->max_heap = es->heap.count;
+    }
+
+    // 데드라인이 더 이르면 퀀텀을 1로 줄여 이번 틱 끝에 선점
+    int curr = sim->cpus[0].current;   // 단일 CPU 전용 정책
+    if (curr != -1 && sim->pcb_state[curr] == RUNNING &&
+        sim->pcb_deadline[index] < sim->pcb_deadline[curr] &&
+        sim->pcb_remaining_quantum[curr] > 1) {
+        sim->pcb_remaining_quantum[curr] = 1;
+    }
+}
+
+// 선점당하지 않는 한 작업(버스트)이 끝날 때까지 실행 (퀀텀 = 남은 버스트)
+static int edf_pick_next(Sim *sim) {
+    EdfState *es = sim->policy_data;
+    int index = mh_pop(&es->heap);
+
+    if (index != -1) {
+        sim->pcb_remaining_quantum[index] = sim->pcb_cpu_burst[index];
+    }
+    return index;
+}
+
+static void edf_remove(Sim *sim, int index) {
+    EdfState *es = sim->policy_data;
+
+    mh_remove(&es->heap, index);
+}
+
+// 퀀텀 만료 = 데드라인이 더 이른 작업에 의한 선점
+static void edf_on_quantum_expiry(Sim *sim, int index) {
+    EdfState *es = sim->policy_data;
+
+    (void)index;
+    es->preemptions++;
+}
+
+static void edf_print_stats(Sim *sim) {
+    EdfState *es = sim->policy_data;
+
+    printf("\n[EDF] 선점: %lld회, 최대 힙 크기: %d\n", es->preemptions, es->max_heap);
+}
+
+static void edf_destroy(Sim *sim) {
+    free(sim->policy_data);
+}
+
+const Policy edf_policy = {
+    .name = "edf",
+    .title = "EDF (데드라인)",
+    .uses_quantum = 1,
+    .init = edf_init,
+    .enqueue = edf_enqueue,
+    .pick_next = edf_pick_next,
+    .remove = edf_remove,
+    .on_quantum_expiry = edf_on_quantum_expiry,
+    .print_stats = edf_print_stats,
+    .destroy = edf_destroy,
+};
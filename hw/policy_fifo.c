@@ -0,0 +1,108 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "sched_engine.h"
+
+// 비선점형 FIFO: Ready Queue에 진입한 순서대로 실행, 실행 중인 프로세스는 버스트가 끝날 때까지 유지
+// 다중 CPU면 CPU마다 Ready Queue를 두고, 다른 CPU가 훔쳐 갈 때는 가장 오래 기다린 머리를 내줌
+typedef struct {
+    int *rq_next;   // Ready Queue 다음 프로세스 (-1 = 없음, PCB 저장소의 열, 모든 CPU 큐가 공유)
+    int *rq_head;   // CPU별 머리/꼬리
+    int *rq_tail;
+} FifoState;
+
+static void fifo_init(Sim *sim) {
+    FifoState *fs = malloc(sizeof(FifoState));
+    if (fs == NULL) {
+        perror("정책 상태 할당 실패");
+        exit(1);
+    }
+    fs->rq_head = malloc(sizeof(int) * sim->num_cpus);
+    fs->rq_tail = malloc(sizeof(int) * sim->num_cpus);
+    if (fs->rq_head == NULL || fs->rq_tail == NULL) {
+        perror("정책 상태 할당 실패");
+        exit(1);
+    }
+    for (int cpu = 0; cpu < sim->num_cpus; cpu++) {
+        fs->rq_head[cpu] = -1;
+        fs->rq_tail[cpu] = -1;
+    }
+    arena_column(&sim->arena, &fs->rq_next, sizeof(int));
+    sim->policy_data = fs;
+}
+
+// 프로세스가 속한 CPU의 Ready Queue 꼬리에 추가
+static void fifo_enqueue(Sim *sim, int index) {
+    FifoState *fs = sim->policy_data;
+    int cpu = sim->pcb_cpu[index];
+
+    fs->rq_next[index] = -1;
+    if (fs->rq_tail[cpu] != -1) {
+        fs->rq_next[fs->rq_tail[cpu]] = index;
+    } else {
+        fs->rq_head[cpu] = index;
+    }
+    fs->rq_tail[cpu] = index;
+}
+
+// cpu의 Ready Queue 머리에서 꺼냄 (비어있으면 -1)
+static int fifo_dequeue(FifoState *fs, int cpu) {
+    int index = fs->rq_head[cpu];
+
+    if (index != -1) {
+        fs->rq_head[cpu] = fs->rq_next[index];
+        if (fs->rq_head[cpu] == -1) {
+            fs->rq_tail[cpu] = -1;
+        }
+        fs->rq_next[index] = -1;
+    }
+    return index;
+}
+
+// 큐 중간에서 제거 (단일 연결 리스트라 앞에서부터 찾음, 외부 종료에서만 쓰임)
+static void fifo_remove(Sim *sim, int index) {
+    FifoState *fs = sim->policy_data;
+    int cpu = sim->pcb_cpu[index];
+    int prev = -1;
+
+    for (int i = fs->rq_head[cpu]; i != -1 && i != index; i = fs->rq_next[i]) {
+        prev = i;
+    }
+    if (prev != -1) {
+        fs->rq_next[prev] = fs->rq_next[index];
+    } else {
+        fs->rq_head[cpu] = fs->rq_next[index];
+    }
+    if (fs->rq_tail[cpu] == index) {
+        fs->rq_tail[cpu] = prev;
+    }
+    fs->rq_next[index] = -1;
+}
+
+static int fifo_pick_next(Sim *sim) {
+    return fifo_dequeue(sim->policy_data, sim->current_cpu);
+}
+
+static int fifo_steal(Sim *sim, int cpu) {
+    return fifo_dequeue(sim->policy_data, cpu);
+}
+
+static void fifo_destroy(Sim *sim) {
+    FifoState *fs = sim->policy_data;
+
+    free(fs->rq_head);
+    free(fs->rq_tail);
+    free(fs);
+}
+
+const Policy fifo_policy = {
+    .name = "fifo",
+    .title = "비선점형 FIFO",
+    .uses_quantum = 0,
+    .init = fifo_init,
+    .enqueue = fifo_enqueue,
+    .pick_next = fifo_pick_next,
+    .remove = fifo_remove,
+    .steal = fifo_steal,
+    .destroy = fifo_destroy,
+};
@@ -0,0 +1,267 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "sched_engine.h"
+
+// 다단계 피드백 큐 (MLFQ)
+// - 새 프로세스는 최상위 레벨 0에서 시작, 레벨 k의 타임 퀀텀 = 기본 퀀텀 × 2^k
+// - 레벨마다 CPU 허용량(퀀텀 × ALLOTMENT_QUANTA)을 두고, I/O로 CPU를 양보해도 사용량은 유지
+//   → 허용량을 다 쓰면 강등 (퀀텀 직전에 I/O를 해서 상위 레벨에 머무는 게이밍 방지)
+// - BOOST_QUANTA × 기본 퀀텀마다 모든 프로세스를 레벨 0으로 올림 (기아 방지, 에이징 카운터 대체)
+//   레벨별 큐를 레벨 0 뒤에 이어 붙이고(O(레벨 수)) 프로세스별 레벨/사용량은 부스트 세대로 지연 초기화
+#define MLFQ_LEVELS 4
+#define ALLOTMENT_QUANTA 2      // 레벨별 허용량 = 그 레벨 퀀텀의 2배
+#define BOOST_QUANTA 20         // 부스트 주기 = 기본 퀀텀의 20배 (틱)
+
+typedef struct {
+    // PCB 저장소의 열
+    int *level;             // 레벨 (boost_epoch가 현재 세대일 때만 유효)
+    int *used;              // 현재 레벨에서 사용한 CPU 틱 (게이밍 방지 누적)
+    int *charged_ticks;     // used에 이미 반영한 실행 틱
+    int *boost_epoch;       // 레벨/사용량을 마지막으로 맞춘 부스트 세대
+    int *rq_next;           // 준비 큐 다음 프로세스 (-1 = 없음)
+
+    // 레벨별 FIFO 준비 큐, 비어있지 않은 레벨은 비트맵에 표시
+    int rq_head[MLFQ_LEVELS];
+    int rq_tail[MLFQ_LEVELS];
+    unsigned int rq_bitmap;
+    int epoch;              // 부스트 세대 (부스트마다 1 증가)
+    int boost_interval;
+
+    // 통계
+    long long level_dispatches[MLFQ_LEVELS];
+    long long level_ticks[MLFQ_LEVELS];
+    long long demotions[MLFQ_LEVELS];   // 레벨 k에서 아래로 강등된 횟수
+    int boosts;
+} MlfqState;
+
+static int level_quantum(Sim *sim, int level) {
+    return sim->config.time_quantum << level;
+}
+
+static int level_allotment(Sim *sim, int level) {
+    return level_quantum(sim, level) * ALLOTMENT_QUANTA;
+}
+
+static void mlfq_init(Sim *sim) {
+    MlfqState *ms = calloc(1, sizeof(MlfqState));
+    if (ms == NULL) {
+        perror("정책 상태 할당 실패");
+        exit(1);
+    }
+    for (int level = 0; level < MLFQ_LEVELS; level++) {
+        ms->rq_head[level] = -1;
+        ms->rq_tail[level] = -1;
+    }
+    ms->boost_interval = BOOST_QUANTA * sim->config.time_quantum;
+    arena_column(&sim->arena, &ms->level, sizeof(int));
+    arena_column(&sim->arena, &ms->used, sizeof(int));
+    arena_column(&sim->arena, &ms->charged_ticks, sizeof(int));
+    arena_column(&sim->arena, &ms->boost_epoch, sizeof(int));
+    arena_column(&sim->arena, &ms->rq_next, sizeof(int));
+    sim->policy_data = ms;
+}
+
+// 마지막 부스트 이후 처음 만지는 프로세스면 레벨 0, 사용량 0으로 맞춤
+static void sync_boost(MlfqState *ms, int index) {
+    if (ms->boost_epoch[index] != ms->epoch) {
+        ms->boost_epoch[index] = ms->epoch;
+        ms->level[index] = 0;
+        ms->used[index] = 0;
+    }
+}
+
+// 마지막 반영 이후 실행한 틱을 그 틱을 실행한 레벨 사용량에 더한 뒤 부스트 세대를 맞춤
+// (I/O 대기 중 부스트가 지나갔으면 대기 전 실행분은 옛 레벨에 정산되고 새 레벨 0 허용량은 온전히 남음)
+static void charge(Sim *sim, MlfqState *ms, int index) {
+    int delta = sim->pcb_run_ticks[index] - ms->charged_ticks[index];
+
+    if (delta > 0) {
+        ms->used[index] += delta;
+        ms->level_ticks[ms->level[index]] += delta;
+        ms->charged_ticks[index] = sim->pcb_run_ticks[index];
+    }
+    sync_boost(ms, index);
+}
+
+// 허용량을 다 쓴 프로세스를 한 레벨 강등 (최하위 레벨은 그대로 라운드 로빈)
+static void charge_and_demote(Sim *sim, MlfqState *ms, int index) {
+    charge(sim, ms, index);
+
+    int level = ms->level[index];
+    if (level < MLFQ_LEVELS - 1 && ms->used[index] >= level_allotment(sim, level)) {
+        ms->demotions[level]++;
+        ms->level[index] = level + 1;
+        ms->used[index] = 0;
+        trace_emit(&sim->trace, TRACE_AGING, sim->current_time, index, level + 1);
+        log_emit(&sim->log, LOG_DETAIL, EVENT_MLFQ_DEMOTE, sim->current_time, index, level,
+                 level_allotment(sim, level), level + 1);
+    }
+}
+
+static void mlfq_admit(Sim *sim, int index) {
+    MlfqState *ms = sim->policy_data;
+
+    ms->boost_epoch[index] = ms->epoch;
+    ms->level[index] = 0;
+    ms->used[index] = 0;
+    ms->charged_ticks[index] = 0;
+}
+
+static void mlfq_enqueue(Sim *sim, int index) {
+    MlfqState *ms = sim->policy_data;
+
+    sync_boost(ms, index);
+    int level = ms->level[index];
+    ms->rq_next[index] = -1;
+    if (ms->rq_tail[level] != -1) {
+        ms->rq_next[ms->rq_tail[level]] = index;
+    } else {
+        ms->rq_head[level] = index;
+    }
+    ms->rq_tail[level] = index;
+    ms->rq_bitmap |= 1u << level;
+}
+
+// 가장 높은 비어있지 않은 레벨의 맨 앞, 슬라이스는 레벨 퀀텀과 남은 허용량 중 작은 값
+static int mlfq_pick_next(Sim *sim) {
+    MlfqState *ms = sim->policy_data;
+
+    if (ms->rq_bitmap == 0) {
+        return -1;
+    }
+    int level = __builtin_ctz(ms->rq_bitmap);
+    int index = ms->rq_head[level];
+    ms->rq_head[level] = ms->rq_next[index];
+    if (ms->rq_head[level] == -1) {
+        ms->rq_tail[level] = -1;
+        ms->rq_bitmap &= ~(1u << level);
+    }
+
+    sync_boost(ms, index);
+    int slice = level_quantum(sim, level);
+    if (level < MLFQ_LEVELS - 1 && level_allotment(sim, level) - ms->used[index] < slice) {
+        slice = level_allotment(sim, level) - ms->used[index];
+    }
+    sim->pcb_remaining_quantum[index] = slice;
+    ms->level_dispatches[level]++;
+    return index;
+}
+
+// 레벨 큐 중간에서 제거 (단일 연결 리스트라 앞에서부터 찾음, 외부 종료에서만 쓰임)
+// 마지막 부스트 이후 처음 만지는 프로세스면 큐가 레벨 0에 이어 붙어 있으므로 세대를 먼저 맞춤
+static void mlfq_remove(Sim *sim, int index) {
+    MlfqState *ms = sim->policy_data;
+    int prev = -1;
+
+    sync_boost(ms, index);
+    int level = ms->level[index];
+    for (int i = ms->rq_head[level]; i != -1 && i != index; i = ms->rq_next[i]) {
+        prev = i;
+    }
+    if (prev != -1) {
+        ms->rq_next[prev] = ms->rq_next[index];
+    } else {
+        ms->rq_head[level] = ms->rq_next[index];
+    }
+    if (ms->rq_tail[level] == index) {
+        ms->rq_tail[level] = prev;
+    }
+    if (ms->rq_head[level] == -1) {
+        ms->rq_bitmap &= ~(1u << level);
+    }
+}
+
+// 부스트: 하위 레벨 큐를 레벨 0 꼬리에 차례로 이어 붙이고 세대를 올림
+// 실행 중인 프로세스는 지금까지의 실행분을 옛 레벨에 정산한 뒤 슬라이스를 레벨 0 퀀텀으로 줄임
+static void mlfq_on_tick(Sim *sim) {
+    MlfqState *ms = sim->policy_data;
+
+    if (sim->current_time % ms->boost_interval != 0) {
+        return;
+    }
+    int curr = sim->cpus[0].current;   // 단일 CPU 전용 정책
+    if (curr != -1 && sim->pcb_state[curr] == RUNNING) {
+        charge(sim, ms, curr);
+        if (sim->pcb_remaining_quantum[curr] > level_quantum(sim, 0)) {
+            sim->pcb_remaining_quantum[curr] = level_quantum(sim, 0);
+        }
+    }
+
+    for (int level = 1; level < MLFQ_LEVELS; level++) {
+        if (ms->rq_head[level] == -1) {
+            continue;
+        }
+        if (ms->rq_tail[0] != -1) {
+            ms->rq_next[ms->rq_tail[0]] = ms->rq_head[level];
+        } else {
+            ms->rq_head[0] = ms->rq_head[level];
+        }
+        ms->rq_tail[0] = ms->rq_tail[level];
+        ms->rq_head[level] = -1;
+        ms->rq_tail[level] = -1;
+    }
+    ms->rq_bitmap = ms->rq_head[0] != -1 ? 1u : 0;
+    ms->epoch++;
+    ms->boosts++;
+    if (curr != -1 && sim->pcb_state[curr] == RUNNING) {
+        sync_boost(ms, curr);   // 부스트 이후 실행분은 레벨 0에 정산
+    }
+    log_emit(&sim->log, LOG_LIFECYCLE, EVENT_MLFQ_BOOST, sim->current_time, 0, 0, 0, 0);
+}
+
+static void mlfq_on_quantum_expiry(Sim *sim, int index) {
+    charge_and_demote(sim, sim->policy_data, index);
+}
+
+// I/O로 CPU를 양보해도 사용량은 초기화하지 않음 (게이밍 방지)
+static void mlfq_on_io_complete(Sim *sim, int index) {
+    charge_and_demote(sim, sim->policy_data, index);
+}
+
+// 가상 시간 모드: 다음 부스트 틱
+static int mlfq_next_event(Sim *sim) {
+    MlfqState *ms = sim->policy_data;
+
+    return ms->boost_interval - sim->current_time % ms->boost_interval;
+}
+
+static void mlfq_print_stats(Sim *sim) {
+    MlfqState *ms = sim->policy_data;
+
+    printf("\n[MLFQ] 레벨 %d개, 부스트 주기 %d틱, 부스트 %d회\n",
+           MLFQ_LEVELS, ms->boost_interval, ms->boosts);
+    printf("[MLFQ] 레벨   퀀텀   허용량   디스패치    실행 틱      강등\n");
+    for (int level = 0; level < MLFQ_LEVELS; level++) {
+        if (level < MLFQ_LEVELS - 1) {
+            printf("[MLFQ] %4d %6d %8d %10lld %10lld %9lld\n", level,
+                   level_quantum(sim, level), level_allotment(sim, level),
+                   ms->level_dispatches[level], ms->level_ticks[level], ms->demotions[level]);
+        } else {
+            printf("[MLFQ] %4d %6d %8s %10lld %10lld %9s\n", level,
+                   level_quantum(sim, level), "-",
+                   ms->level_dispatches[level], ms->level_ticks[level], "-");
+        }
+    }
+}
+
+static void mlfq_destroy(Sim *sim) {
+    free(sim->policy_data);
+}
+
+const Policy mlfq_policy = {
+    .name = "mlfq",
+    .title = "MLFQ (부스트)",
+    .uses_quantum = 1,
+    .init = mlfq_init,
+    .admit = mlfq_admit,
+    .enqueue = mlfq_enqueue,
+    .pick_next = mlfq_pick_next,
+    .remove = mlfq_remove,
+    .on_tick = mlfq_on_tick,
+    .on_quantum_expiry = mlfq_on_quantum_expiry,
+    .on_io_complete = mlfq_on_io_complete,
+    .next_event = mlfq_next_event,
+    .print_stats = mlfq_print_stats,
+    .destroy = mlfq_destroy,
+};
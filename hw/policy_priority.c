@@ -0,0 +1,375 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "sched_engine.h"
+
+// 우선순위 스케줄링 + 에이징
+// - READY 상태로 에이징 간격(틱)만큼 대기할 때마다 우선순위 +에이징 양 (숫자↓ = 우선순위↑)
+//   간격/양은 SimConfig로 설정 (기본 DEFAULT_AGING_INTERVAL / DEFAULT_AGING_AMOUNT)
+// - 타임퀀텀 만료 시 우선순위 -1 (숫자↑), I/O 완료 시 우선순위 +1 (I/O 바운드 프로세스 보상)
+#define NUM_LEVELS (MAX_PRIORITY - MIN_PRIORITY + 1)  // 우선순위 레벨 수 (비트맵 비트 수)
+
+typedef struct {
+    // PCB 저장소의 열
+    int *priority;          // 현재 우선순위 (0=최고, 숫자가 클수록 낮음)
+    int *rq_prev;           // 준비 큐 이전 프로세스 (-1 = 없음)
+    int *rq_next;           // 준비 큐 다음 프로세스 (-1 = 없음)
+    int *in_rq;             // 준비 큐에 들어 있는지 여부
+    int *ag_prev;           // 에이징 버킷 이전 프로세스 (-1 = 없음)
+    int *ag_next;           // 에이징 버킷 다음 프로세스 (-1 = 없음)
+    int *ag_bucket;         // 들어 있는 에이징 버킷 (-1 = 없음)
+    int *reached_top;       // 최고 우선순위 도달 여부 (출력용)
+    int *aging_buf;         // 이번 틱에 에이징되는 프로세스
+
+    // 우선순위별 준비 큐 (O(1) 스케줄러): 레벨마다 FIFO 리스트, 비어있지 않은 레벨은 비트맵에 표시
+    // 같은 우선순위 내 라운드 로빈은 FIFO 순서로 처리
+    int rq_head[NUM_LEVELS];
+    int rq_tail[NUM_LEVELS];
+    unsigned int rq_bitmap;  // 비트 k = 레벨 (MIN_PRIORITY + k) 큐가 비어있지 않음
+
+    // 에이징 버킷: 더 에이징될 수 있는(MIN_PRIORITY보다 낮은) READY 프로세스는 ready_since % aging_interval 버킷에 들어감
+    // 틱 t에서는 버킷 t % aging_interval의 프로세스만 에이징 간격을 채움 (전체 PCB 순회 없음)
+    // READY 동안 우선순위는 에이징으로 올라가기만 하므로 MIN_PRIORITY에 닿으면 버킷에서 빼고 다시 넣지 않음
+    // (틱마다 드는 비용 = 실제로 에이징되는 프로세스 수, 빈 버킷만 남으면 next_event가 에이징 이벤트 없음을 알림)
+    int *aging_bucket;
+    int aging_interval;     // 에이징 간격 (틱)
+    int aging_amount;       // 에이징 시 우선순위 증가량 (숫자 감소)
+} PriorityState;
+
+static void priority_init(Sim *sim) {
+    PriorityState *ps = malloc(sizeof(PriorityState));
+    if (ps == NULL) {
+        perror("정책 상태 할당 실패");
+        exit(1);
+    }
+    for (int level = 0; level < NUM_LEVELS; level++) {
+        ps->rq_head[level] = -1;
+        ps->rq_tail[level] = -1;
+    }
+    ps->rq_bitmap = 0;
+    ps->aging_interval = sim->config.aging_interval;
+    ps->aging_amount = sim->config.aging_amount;
+    ps->aging_bucket = malloc(sizeof(int) * ps->aging_interval);
+    if (ps->aging_bucket == NULL) {
+        perror("정책 상태 할당 실패");
+        exit(1);
+    }
+    for (int bucket = 0; bucket < ps->aging_interval; bucket++) {
+        ps->aging_bucket[bucket] = -1;
+    }
+    arena_column(&sim->arena, &ps->priority, sizeof(int));
+    arena_column(&sim->arena, &ps->rq_prev, sizeof(int));
+    arena_column(&sim->arena, &ps->rq_next, sizeof(int));
+    arena_column(&sim->arena, &ps->in_rq, sizeof(int));
+    arena_column(&sim->arena, &ps->ag_prev, sizeof(int));
+    arena_column(&sim->arena, &ps->ag_next, sizeof(int));
+    arena_column(&sim->arena, &ps->ag_bucket, sizeof(int));
+    arena_column(&sim->arena, &ps->reached_top, sizeof(int));
+    arena_column(&sim->arena, &ps->aging_buf, sizeof(int));
+    sim->policy_data = ps;
+}
+
+// 현재 우선순위 레벨의 큐 꼬리에 추가
+static void rq_enqueue(PriorityState *ps, int index) {
+    int level = ps->priority[index] - MIN_PRIORITY;
+
+    ps->rq_prev[index] = ps->rq_tail[level];
+    ps->rq_next[index] = -1;
+    if (ps->rq_tail[level] != -1) {
+        ps->rq_next[ps->rq_tail[level]] = index;
+    } else {
+        ps->rq_head[level] = index;
+    }
+    ps->rq_tail[level] = index;
+    ps->in_rq[index] = 1;
+    ps->rq_bitmap |= 1u << level;
+}
+
+// 큐 중간에서도 O(1)로 제거 (이중 연결 리스트)
+static void rq_remove(PriorityState *ps, int index) {
+    int level = ps->priority[index] - MIN_PRIORITY;
+
+    if (ps->rq_prev[index] != -1) {
+        ps->rq_next[ps->rq_prev[index]] = ps->rq_next[index];
+    } else {
+        ps->rq_head[level] = ps->rq_next[index];
+    }
+    if (ps->rq_next[index] != -1) {
+        ps->rq_prev[ps->rq_next[index]] = ps->rq_prev[index];
+    } else {
+        ps->rq_tail[level] = ps->rq_prev[index];
+    }
+    ps->rq_prev[index] = -1;
+    ps->rq_next[index] = -1;
+    ps->in_rq[index] = 0;
+    if (ps->rq_head[level] == -1) {
+        ps->rq_bitmap &= ~(1u << level);
+    }
+}
+
+static void ag_link(PriorityState *ps, int index, int bucket) {
+    ps->ag_prev[index] = -1;
+    ps->ag_next[index] = ps->aging_bucket[bucket];
+    if (ps->aging_bucket[bucket] != -1) {
+        ps->ag_prev[ps->aging_bucket[bucket]] = index;
+    }
+    ps->aging_bucket[bucket] = index;
+    ps->ag_bucket[index] = bucket;
+}
+
+// 넣을 때 기록한 버킷에서 제거 (들어 있지 않으면 아무것도 안 함)
+static void ag_unlink(PriorityState *ps, int index) {
+    if (ps->ag_bucket[index] == -1) {
+        return;
+    }
+    if (ps->ag_prev[index] != -1) {
+        ps->ag_next[ps->ag_prev[index]] = ps->ag_next[index];
+    } else {
+        ps->aging_bucket[ps->ag_bucket[index]] = ps->ag_next[index];
+    }
+    if (ps->ag_next[index] != -1) {
+        ps->ag_prev[ps->ag_next[index]] = ps->ag_prev[index];
+    }
+    ps->ag_bucket[index] = -1;
+}
+
+// 우선순위 변경 (범위 제한). 큐에 있으면 새 레벨 큐의 꼬리로 옮김
+static void set_priority(PriorityState *ps, int index, int priority) {
+    if (priority < MIN_PRIORITY) priority = MIN_PRIORITY;
+    if (priority > MAX_PRIORITY) priority = MAX_PRIORITY;
+    if (priority == ps->priority[index]) {
+        return;
+    }
+
+    if (ps->in_rq[index]) {
+        rq_remove(ps, index);
+        ps->priority[index] = priority;
+        rq_enqueue(ps, index);
+    } else {
+        ps->priority[index] = priority;
+    }
+}
+
+// 새 프로세스는 작업 부하가 정한 우선순위로 시작
+static void priority_admit(Sim *sim, int index) {
+    PriorityState *ps = sim->policy_data;
+
+    ps->priority[index] = sim->pcb_cold[index].initial_priority;
+    ps->in_rq[index] = 0;
+    ps->ag_bucket[index] = -1;
+    ps->reached_top[index] = 0;
+}
+
+// READY 진입: 준비 큐에 추가하고, 더 에이징될 수 있으면 에이징 버킷에도 추가
+static void priority_enqueue(Sim *sim, int index) {
+    PriorityState *ps = sim->policy_data;
+
+    if (ps->priority[index] > MIN_PRIORITY && ps->aging_amount > 0) {
+        ag_link(ps, index, sim->current_time % ps->aging_interval);
+    }
+    rq_enqueue(ps, index);
+}
+
+// 비트맵에서 가장 높은 우선순위(낮은 숫자) 레벨을 찾아 큐 맨 앞을 꺼내고 에이징 버킷에서도 제거
+static int priority_pick_next(Sim *sim) {
+    PriorityState *ps = sim->policy_data;
+
+    if (ps->rq_bitmap == 0) {
+        return -1;
+    }
+    int index = ps->rq_head[__builtin_ffs(ps->rq_bitmap) - 1];
+
+    ag_unlink(ps, index);
+    rq_remove(ps, index);
+    return index;
+}
+
+static void priority_remove(Sim *sim, int index) {
+    PriorityState *ps = sim->policy_data;
+
+    ag_unlink(ps, index);
+    rq_remove(ps, index);
+}
+
+// 이번 틱에 READY 상태로 에이징 간격을 채운 프로세스만 에이징
+// (틱 단위로 카운터를 올리던 방식과 같은 시점에 같은 순서로 우선순위 변경)
+static void priority_on_tick(Sim *sim) {
+    PriorityState *ps = sim->policy_data;
+    int bucket = sim->current_time % ps->aging_interval;
+    int count = 0;
+
+    // 버킷에는 아직 최고 우선순위가 아닌 프로세스만 있음
+    for (int i = ps->aging_bucket[bucket]; i != -1; i = ps->ag_next[i]) {
+        ps->aging_buf[count++] = i;
+    }
+    sort_indices(ps->aging_buf, count);  // 준비 큐 재배치 순서를 인덱스 순으로 유지
+
+    for (int k = 0; k < count; k++) {
+        int i = ps->aging_buf[k];
+
+        // 에이징 간격마다 우선순위 증가 (숫자 감소 = 더 높은 우선순위)
+        set_priority(ps, i, ps->priority[i] - ps->aging_amount);
+        trace_emit(&sim->trace, TRACE_AGING, sim->current_time, i, ps->priority[i]);
+        if (ps->priority[i] == MIN_PRIORITY) {
+            ag_unlink(ps, i);   // 더 올라갈 수 없음 (다시 READY가 될 때 필요하면 넣음)
+        }
+
+        // 에이징 출력: 초기 우선순위가 낮았던(3이상) 프로세스가 처음으로 최고 우선순위(0) 도달할 때만
+        if (sim->pcb_cold[i].initial_priority >= 3 &&
+            ps->priority[i] == 0 &&
+            ps->reached_top[i] == 0) {
+            log_emit(&sim->log, LOG_LIFECYCLE, EVENT_AGING_TOP, sim->current_time, i,
+                     sim->pcb_cold[i].initial_priority, 0, 0);
+            ps->reached_top[i] = 1;
+        }
+    }
+}
+
+// 타임 퀀텀 만료 시 우선순위 낮춤 (숫자 증가)
+static void priority_on_quantum_expiry(Sim *sim, int index) {
+    PriorityState *ps = sim->policy_data;
+
+    set_priority(ps, index, ps->priority[index] + 1);
+    sim->pcb_remaining_quantum[index] = sim->config.time_quantum;
+}
+
+// I/O 완료 시 우선순위 약간 높임 (I/O 바운드 프로세스 보상)
+static void priority_on_io_complete(Sim *sim, int index) {
+    PriorityState *ps = sim->policy_data;
+
+    set_priority(ps, index, ps->priority[index] - 1);
+    sim->pcb_remaining_quantum[index] = sim->config.time_quantum;
+}
+
+// 에이징: 비어있지 않은 (에이징될 수 있는 프로세스가 있는) 다음 버킷까지의 거리
+static int priority_next_event(Sim *sim) {
+    PriorityState *ps = sim->policy_data;
+
+    for (int ticks = 1; ticks <= ps->aging_interval; ticks++) {
+        if (ps->aging_bucket[(sim->current_time + ticks) % ps->aging_interval] != -1) {
+            return ticks;
+        }
+    }
+    return -1;
+}
+
+// 정렬 키 오름차순 비교 (qsort용)
+static int compare_key(const void *a, const void *b) {
+    long long ka = *(const long long *)a, kb = *(const long long *)b;
+    return (ka > kb) - (ka < kb);
+}
+
+// 에이징 효과 분석: 초기 우선순위가 낮았던 프로세스가 먼저 끝난 경우(역전)를 셈
+static void priority_print_stats(Sim *sim) {
+    PriorityState *ps = sim->policy_data;
+    int n = sim->num_processes;
+    int *completion_order = malloc(sizeof(int) * (n > 0 ? n : 1));
+    long long *keys = malloc(sizeof(long long) * (n > 0 ? n : 1));
+    int count = 0;
+
+    // 종료 순서: (종료 시간, 인덱스)를 한 키로 묶어 정렬
+    for (int i = 0; i < n; i++) {
+        if (sim->pcb_cold[i].completion_time != -1) {
+            keys[count++] = (long long)sim->pcb_cold[i].completion_time * n + i;
+        }
+    }
+    qsort(keys, count, sizeof(long long), compare_key);
+    for (int k = 0; k < count; k++) {
+        completion_order[k] = (int)(keys[k] % n);
+    }
+    free(keys);
+
+    printf("\n");
+    printf("┌─────────────────────────────────────────────────────────────────┐\n");
+    printf("│                    🔄 에이징 효과 분석                          │\n");
+    printf("├─────────────────────────────────────────────────────────────────┤\n");
+    printf("│ 에이징 간격: %d초, 증가량: %d\n", ps->aging_interval, ps->aging_amount);
+
+    // 종료 순서 출력
+    printf("│ 종료 순서: ");
+    for (int i = 0; i < count && i < 10; i++) {
+        printf("P%d", completion_order[i]);
+        if (i < count - 1 && i < 9) printf(" → ");
+    }
+    printf("\n");
+
+    // 우선순위 역전 분석
+    long long reversals = 0;
+    printf("│                                                                 │\n");
+    printf("│ 우선순위 역전 발생:                                             │\n");
+
+    // 역전 건수: 종료 순서를 뒤에서부터 훑으며 레벨별 개수로 계산 (O(n * 레벨 수))
+    int later_count[NUM_LEVELS] = {0};
+    for (int i = count - 1; i >= 0; i--) {
+        int level = sim->pcb_cold[completion_order[i]].initial_priority;
+        for (int l = 0; l < level; l++) {
+            reversals += later_count[l];
+        }
+        later_count[level]++;
+    }
+
+    // 표시할 역전 (최대 5개): 뒤쪽 최소 우선순위로 역전이 없는 위치는 건너뜀
+    int *suffix_min = malloc(sizeof(int) * (count + 1));
+    suffix_min[count] = NUM_LEVELS;
+    for (int i = count - 1; i >= 0; i--) {
+        int level = sim->pcb_cold[completion_order[i]].initial_priority;
+        suffix_min[i] = level < suffix_min[i + 1] ? level : suffix_min[i + 1];
+    }
+
+    int shown = 0;
+    for (int i = 0; i < count && shown < 5; i++) {
+        int pi = completion_order[i];
+        if (suffix_min[i + 1] >= sim->pcb_cold[pi].initial_priority) {
+            continue;
+        }
+        for (int j = i + 1; j < count && shown < 5; j++) {
+            int pj = completion_order[j];
+            // 초기 우선순위가 낮았던(숫자 큰) 프로세스가 먼저 끝났으면 역전
+            if (sim->pcb_cold[pi].initial_priority > sim->pcb_cold[pj].initial_priority) {
+                printf("│   • P%d(초기:%d)가 P%d(초기:%d)보다 먼저 종료! ✓           │\n",
+                       pi, sim->pcb_cold[pi].initial_priority,
+                       pj, sim->pcb_cold[pj].initial_priority);
+                shown++;
+            }
+        }
+    }
+    free(suffix_min);
+
+    if (reversals == 0) {
+        printf("│   (역전 없음 - 초기 우선순위 순서대로 종료됨)                  │\n");
+    } else if (reversals > 5) {
+        printf("│   ... 외 %lld건 더                                              │\n", reversals - 5);
+    }
+
+    printf("│                                                                 │\n");
+    printf("│ 📈 에이징 효과: 총 %lld건의 우선순위 역전 발생!                   │\n", reversals);
+    if (reversals > 0) {
+        printf("│    → 낮은 우선순위 프로세스도 기아 없이 실행됨 ✓              │\n");
+    }
+    printf("└─────────────────────────────────────────────────────────────────┘\n");
+    free(completion_order);
+}
+
+static void priority_destroy(Sim *sim) {
+    PriorityState *ps = sim->policy_data;
+
+    free(ps->aging_bucket);
+    free(ps);
+}
+
+const Policy priority_policy = {
+    .name = "priority",
+    .title = "우선순위 + 에이징",
+    .uses_quantum = 1,
+    .init = priority_init,
+    .admit = priority_admit,
+    .enqueue = priority_enqueue,
+    .pick_next = priority_pick_next,
+    .remove = priority_remove,
+    .on_tick = priority_on_tick,
+    .on_quantum_expiry = priority_on_quantum_expiry,
+    .on_io_complete = priority_on_io_complete,
+    .next_event = priority_next_event,
+    .print_stats = priority_print_stats,
+    .destroy = priority_destroy,
+};
@@ -0,0 +1,90 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "sched_engine.h"
+
+// 라운드 로빈: 마지막으로 스케줄한 프로세스 다음부터 인덱스 순으로 타임 퀀텀이 남은 READY 프로세스 선택
+// 퀀텀은 만료/I/O 복귀 때 개별로 채우지 않고, 남은 READY 프로세스가 모두 소진했을 때 한꺼번에 초기화
+typedef struct {
+    int last_scheduled;
+} RRState;
+
+static void rr_init(Sim *sim) {
+    RRState *rs = malloc(sizeof(RRState));
+    if (rs == NULL) {
+        perror("정책 상태 할당 실패");
+        exit(1);
+    }
+    rs->last_scheduled = -1;
+    sim->policy_data = rs;
+}
+
+// 준비 큐 없이 pick_next가 PCB 상태를 직접 훑음
+static void rr_enqueue(Sim *sim, int index) {
+    (void)sim;
+    (void)index;
+}
+
+static int find_next_ready_process(Sim *sim) {
+    RRState *rs = sim->policy_data;
+    int n = sim->num_processes;
+
+    // 라운드 로빈: 마지막 스케줄 다음 프로세스부터 순환 탐색
+    for (int k = 1; k <= n; k++) {
+        int i = (rs->last_scheduled + k) % n;
+        if (sim->pcb_state[i] == READY && sim->pcb_remaining_quantum[i] > 0) {
+            return i;
+        }
+    }
+    return -1;  // 타임퀀텀이 남은 READY 프로세스 없음
+}
+
+static void reset_all_quantum(Sim *sim) {
+    for (int i = 0; i < sim->num_processes; i++) {
+        if (sim->pcb_state[i] != DONE) {
+            sim->pcb_remaining_quantum[i] = sim->config.time_quantum;
+        }
+    }
+}
+
+static int rr_pick_next(Sim *sim) {
+    RRState *rs = sim->policy_data;
+    int next = find_next_ready_process(sim);
+
+    // 타임퀀텀이 남은 READY 프로세스가 없으면 전체 리셋 시도
+    if (next == -1) {
+        // READY 상태인 프로세스가 있는지 확인 (타임퀀텀은 0이지만)
+        int has_ready = 0;
+        for (int i = 0; i < sim->num_processes; i++) {
+            if (sim->pcb_state[i] == READY) {
+                has_ready = 1;
+                break;
+            }
+        }
+
+        if (has_ready) {
+            log_emit(&sim->log, LOG_DETAIL, EVENT_QUANTUM_RESET, sim->current_time, 0, 0, 0, 0);
+            reset_all_quantum(sim);
+            next = find_next_ready_process(sim);  // 리셋 후 다시 찾기
+        }
+    }
+
+    if (next != -1) {
+        rs->last_scheduled = next;  // 라운드 로빈을 위해 마지막 스케줄 기록
+    }
+    return next;
+}
+
+static void rr_destroy(Sim *sim) {
+    free(sim->policy_data);
+}
+
+const Policy rr_policy = {
+    .name = "rr",
+    .title = "라운드 로빈",
+    .uses_quantum = 1,
+    .init = rr_init,
+    .enqueue = rr_enqueue,
+    .pick_next = rr_pick_next,
+    .destroy = rr_destroy,
+};
@@ -0,0 +1,307 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+
+#include "sched_engine.h"
+#include "minheap.h"
+#include "fenwick.h"
+
+// 비례 배분 스케줄링 (티켓 수에 비례해 CPU를 나눔)
+// - 티켓: 작업 부하 우선순위 0..10 → 1100..100 (우선순위 한 단계 = TICKETS_PER_LEVEL)
+// - 스트라이드: stride = STRIDE1 / 티켓, 실행한 틱마다 pass += stride, 최소 pass를 최소 힙에서 선택
+//   잠들 때 global_pass와의 차이(remain)를 저장하고 깨어나면 global_pass + remain에서 다시 시작
+// - 로터리: READY 프로세스의 티켓을 펜윅 트리에 두고 난수 하나로 당첨자를 O(log n)에 추첨
+//   (64비트 난수를 거절 샘플링해 티켓 합이 RAND_MAX를 넘어도 모듈로 편향 없이 균등 추첨)
+// 기대 실행량은 실행 가능한(READY/RUNNING) 동안 티켓 / 실행 가능한 티켓 합을 틱마다 적분한 값
+// (공정 큐잉의 가상 시계: vclock = ∫ dt / 티켓 합, 기대 = 티켓 × vclock 증가분, global_pass = STRIDE1 × vclock)
+#define TICKETS_PER_LEVEL 100
+#define STRIDE1 (1LL << 20)
+
+typedef struct {
+    int lottery;                // 0 = 스트라이드, 1 = 로터리
+
+    // PCB 저장소의 열
+    int *tickets;
+    long long *stride;
+    MinHeap heap;               // 키 = pass (스트라이드)
+    int *charged_ticks;         // pass에 이미 반영한 실행 틱
+    long long *remain;          // 잠든 동안 보관하는 pass - global_pass
+    double *join_clock;         // 실행 가능해진 시점의 vclock
+    double *entitled;           // 기대 실행 틱 누적
+
+    Fenwick fenwick;            // 로터리: 위치 = 프로세스 인덱스, 값 = READY면 티켓 아니면 0
+    uint64_t rng;               // 로터리 추첨 난수 상태 (시드로 초기화해 재현 가능)
+
+    // 기대 실행량 가상 시계
+    double vclock;
+    int vclock_time;
+    long long runnable_tickets;
+    int running;                // 마지막으로 선택한 프로세스 (실행 가능 상태에서 빠졌는지 확인용)
+
+    long long draws;
+} ShareState;
+
+static int priority_to_tickets(int priority) {
+    return (MAX_PRIORITY - priority + 1) * TICKETS_PER_LEVEL;
+}
+
+static void share_setup(Sim *sim, int lottery) {
+    ShareState *ss = calloc(1, sizeof(ShareState));
+    if (ss == NULL) {
+        perror("정책 상태 할당 실패");
+        exit(1);
+    }
+    ss->lottery = lottery;
+    ss->running = -1;
+    ss->rng = sim->config.seed ^ 0x9e3779b97f4a7c15ULL;
+    mh_init(&ss->heap);
+    arena_column(&sim->arena, &ss->tickets, sizeof(int));
+    arena_column(&sim->arena, &ss->stride, sizeof(long long));
+    arena_column(&sim->arena, &ss->heap.heap, sizeof(int));
+    arena_column(&sim->arena, &ss->heap.key, sizeof(long long));
+    arena_column(&sim->arena, &ss->charged_ticks, sizeof(int));
+    arena_column(&sim->arena, &ss->remain, sizeof(long long));
+    arena_column(&sim->arena, &ss->join_clock, sizeof(double));
+    arena_column(&sim->arena, &ss->entitled, sizeof(double));
+    if (lottery) {
+        // 설정된 프로세스 수로 할당 (작업 트레이스 재생으로 더 도착하면 admit에서 두 배씩 늘림)
+        long long *tree = calloc(sim->config.num_processes + 1, sizeof(long long));
+        if (tree == NULL) {
+            perror("펜윅 트리 할당 실패");
+            exit(1);
+        }
+        fw_init(&ss->fenwick, tree, sim->config.num_processes);
+    }
+    sim->policy_data = ss;
+}
+
+static void stride_init(Sim *sim) {
+    share_setup(sim, 0);
+}
+
+static void lottery_init(Sim *sim) {
+    share_setup(sim, 1);
+}
+
+// splitmix64 (상태 64비트, 주기 2^64)
+static uint64_t next_random(uint64_t *state) {
+    uint64_t z = (*state += 0x9e3779b97f4a7c15ULL);
+
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+    return z ^ (z >> 31);
+}
+
+// [0, bound) 균등 난수: 2^64 mod bound보다 작은 값을 버려 남은 범위가 bound의 배수가 되게 함
+static long long random_below(uint64_t *state, long long bound) {
+    uint64_t threshold = -(uint64_t)bound % (uint64_t)bound;
+    uint64_t r;
+
+    do {
+        r = next_random(state);
+    } while (r < threshold);
+    return (long long)(r % (uint64_t)bound);
+}
+
+static void advance_clock(Sim *sim, ShareState *ss) {
+    if (ss->runnable_tickets > 0) {
+        ss->vclock += (double)(sim->current_time - ss->vclock_time) / ss->runnable_tickets;
+    }
+    ss->vclock_time = sim->current_time;
+}
+
+static long long global_pass(ShareState *ss) {
+    return (long long)(ss->vclock * STRIDE1);
+}
+
+// 마지막 반영 이후 실행한 틱만큼 pass 증가
+static void charge(Sim *sim, ShareState *ss, int index) {
+    int delta = sim->pcb_run_ticks[index] - ss->charged_ticks[index];
+
+    ss->heap.key[index] += ss->stride[index] * delta;
+    ss->charged_ticks[index] = sim->pcb_run_ticks[index];
+}
+
+// 실행 가능 집합에 들어옴 (생성, I/O 완료)
+static void join(Sim *sim, ShareState *ss, int index) {
+    advance_clock(sim, ss);
+    ss->join_clock[index] = ss->vclock;
+    ss->runnable_tickets += ss->tickets[index];
+    ss->heap.key[index] = global_pass(ss) + ss->remain[index];
+}
+
+// 실행 가능 집합에서 나감 (I/O 요청, 종료, 준비 큐에서 외부 종료)
+static void leave(Sim *sim, ShareState *ss, int index) {
+    charge(sim, ss, index);
+    advance_clock(sim, ss);
+    ss->entitled[index] += ss->tickets[index] * (ss->vclock - ss->join_clock[index]);
+    ss->runnable_tickets -= ss->tickets[index];
+    ss->remain[index] = ss->heap.key[index] - global_pass(ss);
+}
+
+static void share_admit(Sim *sim, int index) {
+    ShareState *ss = sim->policy_data;
+
+    if (ss->lottery && index >= ss->fenwick.size) {
+        int size = ss->fenwick.size > 0 ? ss->fenwick.size * 2 : JOB_INITIAL_CAPACITY;
+        while (size <= index) {
+            size *= 2;
+        }
+        long long *tree = realloc(ss->fenwick.tree, sizeof(long long) * (size + 1));
+        if (tree == NULL) {
+            perror("펜윅 트리 확장 실패");
+            exit(1);
+        }
+        fw_grow(&ss->fenwick, tree, size);
+    }
+    ss->tickets[index] = priority_to_tickets(sim->pcb_cold[index].initial_priority);
+    ss->stride[index] = STRIDE1 / ss->tickets[index];
+    ss->charged_ticks[index] = 0;
+    ss->remain[index] = ss->stride[index];
+    ss->entitled[index] = 0;
+    join(sim, ss, index);
+}
+
+static void share_enqueue(Sim *sim, int index) {
+    ShareState *ss = sim->policy_data;
+
+    charge(sim, ss, index);
+    if (ss->lottery) {
+        fw_add(&ss->fenwick, index, ss->tickets[index]);
+    } else {
+        mh_push(&ss->heap, index);
+    }
+}
+
+// 디스패치는 실행하던 프로세스가 나간 직후에 불리므로 여기서 I/O 요청/종료한 프로세스를 정산
+static int share_pick_next(Sim *sim) {
+    ShareState *ss = sim->policy_data;
+    int prev = ss->running;
+    int index;
+
+    if (prev != -1 && (sim->pcb_state[prev] == SLEEP || sim->pcb_state[prev] == DONE)) {
+        leave(sim, ss, prev);
+    }
+    ss->running = -1;
+
+    if (ss->lottery) {
+        if (ss->fenwick.total == 0) {
+            return -1;
+        }
+        index = fw_find(&ss->fenwick, random_below(&ss->rng, ss->fenwick.total));
+        fw_add(&ss->fenwick, index, -ss->tickets[index]);
+        ss->draws++;
+    } else {
+        index = mh_pop(&ss->heap);
+        if (index == -1) {
+            return -1;
+        }
+    }
+    sim->pcb_remaining_quantum[index] = sim->config.time_quantum;
+    ss->running = index;
+    return index;
+}
+
+// 준비 큐에서 외부 종료: 큐에서 뺀 뒤 실행 가능 집합에서도 정산 (pick_next의 정산은 실행하던 프로세스만 봄)
+static void share_remove(Sim *sim, int index) {
+    ShareState *ss = sim->policy_data;
+
+    if (ss->lottery) {
+        fw_add(&ss->fenwick, index, -ss->tickets[index]);
+    } else {
+        mh_remove(&ss->heap, index);
+    }
+    leave(sim, ss, index);
+    if (ss->running == index) {
+        ss->running = -1;
+    }
+}
+
+static void share_on_io_complete(Sim *sim, int index) {
+    join(sim, sim->policy_data, index);
+}
+
+// 티켓 클래스별, 프로세스별 기대 실행량 대비 실제 실행량
+// 오차 = Σ|실제 - 기대| / Σ기대 (0이면 실행 가능한 동안 정확히 티켓 비율대로 CPU를 받음)
+static void share_print_stats(Sim *sim) {
+    ShareState *ss = sim->policy_data;
+    int levels = MAX_PRIORITY - MIN_PRIORITY + 1;
+    double class_entitled[MAX_PRIORITY - MIN_PRIORITY + 1] = {0};
+    long long class_run[MAX_PRIORITY - MIN_PRIORITY + 1] = {0};
+    int class_count[MAX_PRIORITY - MIN_PRIORITY + 1] = {0};
+    double total_entitled = 0, total_error = 0;
+
+    for (int i = 0; i < sim->num_processes; i++) {
+        int level = sim->pcb_cold[i].initial_priority - MIN_PRIORITY;
+        double diff = sim->pcb_run_ticks[i] - ss->entitled[i];
+        class_entitled[level] += ss->entitled[i];
+        class_run[level] += sim->pcb_run_ticks[i];
+        class_count[level]++;
+        total_entitled += ss->entitled[i];
+        total_error += diff < 0 ? -diff : diff;
+    }
+
+    printf("\n[비례 배분] %s, 티켓 = (%d - 우선순위 + 1) × %d\n",
+           ss->lottery ? "로터리 (펜윅 트리 추첨)" : "스트라이드 (최소 pass)", MAX_PRIORITY, TICKETS_PER_LEVEL);
+    if (ss->lottery) {
+        printf("[비례 배분] 추첨 %lld회\n", ss->draws);
+    }
+    printf("[비례 배분]  티켓  프로세스    기대 실행    실제 실행   실제/기대\n");
+    for (int level = 0; level < levels; level++) {
+        if (class_count[level] == 0) {
+            continue;
+        }
+        printf("[비례 배분] %5d %9d %12.1f %12lld %11.3f\n",
+               priority_to_tickets(level + MIN_PRIORITY), class_count[level], class_entitled[level],
+               class_run[level], class_entitled[level] > 0 ? class_run[level] / class_entitled[level] : 0.0);
+    }
+    printf("[비례 배분] 프로세스별 (기대 실행 → 실제 실행):\n");
+    for (int i = 0; i < sim->num_processes && i < MAX_PRINT_PROCESSES; i++) {
+        printf("[비례 배분]   P%-4d 티켓 %4d: %8.1f → %6d (%.3f)\n",
+               i, ss->tickets[i], ss->entitled[i], sim->pcb_run_ticks[i],
+               ss->entitled[i] > 0 ? sim->pcb_run_ticks[i] / ss->entitled[i] : 0.0);
+    }
+    if (sim->num_processes > MAX_PRINT_PROCESSES) {
+        printf("[비례 배분]   ... (외 %d개 프로세스 생략)\n", sim->num_processes - MAX_PRINT_PROCESSES);
+    }
+    if (total_entitled > 0) {
+        printf("[비례 배분] 점유율 오차: %.2f%%\n", total_error / total_entitled * 100);
+    }
+}
+
+static void share_destroy(Sim *sim) {
+    ShareState *ss = sim->policy_data;
+
+    if (ss->lottery) {
+        free(ss->fenwick.tree);
+    }
+    free(ss);
+}
+
+const Policy stride_policy = {
+    .name = "stride",
+    .title = "스트라이드",
+    .uses_quantum = 1,
+    .init = stride_init,
+    .admit = share_admit,
+    .enqueue = share_enqueue,
+    .pick_next = share_pick_next,
+    .remove = share_remove,
+    .on_io_complete = share_on_io_complete,
+    .print_stats = share_print_stats,
+    .destroy = share_destroy,
+};
+
+const Policy lottery_policy = {
+    .name = "lottery",
+    .title = "로터리",
+    .uses_quantum = 1,
+    .init = lottery_init,
+    .admit = share_admit,
+    .enqueue = share_enqueue,
+    .pick_next = share_pick_next,
+    .remove = share_remove,
+    .on_io_complete = share_on_io_complete,
+    .print_stats = share_print_stats,
+    .destroy = share_destroy,
+};
@@ -0,0 +1,204 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "sched_engine.h"
+#include "minheap.h"
+
+// SJF / SRTF (최단 작업 우선 / 최단 잔여 시간 우선)
+// - 다음 CPU 버스트 길이를 지수 평균으로 예측: tau = a × 실제 + (1 - a) × tau
+// - READY 프로세스는 예측값 순 최소 힙에 두고 가장 짧은 것을 O(log n)으로 선택
+// - SRTF는 예측 잔여 시간(tau - 이번 버스트에서 실행한 틱)이 실행 중인 프로세스보다 짧은 프로세스가
+//   깨어나면 이번 틱 끝에 선점
+// - 오라클은 실제 남은 버스트로 SRTF를 수행 (예측기가 얼마나 근접하는지 비교 기준)
+#define TAU_SHIFT 8             // 예측값 고정소수점 (1틱 = 1 << TAU_SHIFT)
+#define ALPHA_NUM 1             // 지수 평균 가중치 a = 1/2
+#define ALPHA_DEN 2
+
+typedef struct {
+    MinHeap heap;               // 키 = 예측 (잔여) 버스트 (PCB 저장소의 열)
+    long long *tau;             // 다음 버스트 예측값
+    int *burst_start;           // 현재 버스트 시작 시점의 run_ticks
+    int preemptive;
+    int oracle;
+    long long tau0;             // 예측 초기값 (버스트 범위의 평균)
+
+    // 통계
+    long long abs_error;        // |예측 - 실제| 합 (고정소수점)
+    long long actual_sum;       // 실제 버스트 합 (틱)
+    long long predictions;
+    long long preemptions;
+    int max_heap;
+} SjfState;
+
+static void sjf_setup(Sim *sim, int preemptive, int oracle) {
+    SjfState *ss = calloc(1, sizeof(SjfState));
+    if (ss == NULL) {
+        perror("정책 상태 할당 실패");
+        exit(1);
+    }
+    mh_init(&ss->heap);
+    ss->preemptive = preemptive;
+    ss->oracle = oracle;
+    ss->tau0 = ((long long)(sim->config.max_burst + 1) << TAU_SHIFT) / 2;
+    arena_column(&sim->arena, &ss->heap.heap, sizeof(int));
+    arena_column(&sim->arena, &ss->heap.key, sizeof(long long));
+    arena_column(&sim->arena, &ss->tau, sizeof(long long));
+    arena_column(&sim->arena, &ss->burst_start, sizeof(int));
+    sim->policy_data = ss;
+}
+
+static void sjf_init(Sim *sim) {
+    sjf_setup(sim, 0, 0);
+}
+
+static void srtf_init(Sim *sim) {
+    sjf_setup(sim, 1, 0);
+}
+
+static void oracle_init(Sim *sim) {
+    sjf_setup(sim, 1, 1);
+}
+
+// 이번 버스트의 예측 잔여 시간 (예측보다 오래 실행했으면 0)
+static long long predicted_remaining(Sim *sim, SjfState *ss, int index) {
+    if (ss->oracle) {
+        return (long long)sim->pcb_cpu_burst[index] << TAU_SHIFT;
+    }
+    long long ran = (long long)(sim->pcb_run_ticks[index] - ss->burst_start[index]) << TAU_SHIFT;
+    return ss->tau[index] > ran ? ss->tau[index] - ran : 0;
+}
+
+static void sjf_admit(Sim *sim, int index) {
+    SjfState *ss = sim->policy_data;
+
+    ss->tau[index] = ss->tau0;
+    ss->burst_start[index] = 0;
+}
+
+static void sjf_enqueue(Sim *sim, int index) {
+    SjfState *ss = sim->policy_data;
+
+    ss->heap.key[index] = predicted_remaining(sim, ss, index);
+    mh_push(&ss->heap, index);
+    if (ss->heap.count > ss->max_heap) {
+        ss->max_heap = ss->heap.count;
+    }
+
+    // SRTF: 실행 중인 프로세스보다 짧으면 퀀텀을 1로 줄여 이번 틱 끝에 선점
+    int curr = sim->cpus[0].current;   // 단일 CPU 전용 정책
+    if (ss->preemptive && curr != -1 && sim->pcb_state[curr] == RUNNING &&
+        ss->heap.key[index] < predicted_remaining(sim, ss, curr) &&
+        sim->pcb_remaining_quantum[curr] > 1) {
+        sim->pcb_remaining_quantum[curr] = 1;
+    }
+}
+
+// SRTF는 선점당하지 않는 한 버스트가 끝날 때까지 실행 (퀀텀 = 남은 버스트)
+static int sjf_pick_next(Sim *sim) {
+    SjfState *ss = sim->policy_data;
+    int index = mh_pop(&ss->heap);
+
+    if (index != -1 && ss->preemptive) {
+        sim->pcb_remaining_quantum[index] = sim->pcb_cpu_burst[index];
+    }
+    return index;
+}
+
+static void sjf_remove(Sim *sim, int index) {
+    SjfState *ss = sim->policy_data;
+
+    mh_remove(&ss->heap, index);
+}
+
+// SRTF에서 퀀텀 만료 = 더 짧은 프로세스에 의한 선점
+static void sjf_on_quantum_expiry(Sim *sim, int index) {
+    SjfState *ss = sim->policy_data;
+
+    (void)index;
+    ss->preemptions++;
+}
+
+// 버스트가 끝나고 I/O에서 돌아오면 실제 길이로 예측값 갱신
+// (종료로 끝난 마지막 버스트는 다음 예측이 없으므로 오차 집계에서 제외)
+static void sjf_on_io_complete(Sim *sim, int index) {
+    SjfState *ss = sim->policy_data;
+    int actual = sim->pcb_run_ticks[index] - ss->burst_start[index];
+    long long actual_fp = (long long)actual << TAU_SHIFT;
+
+    if (!ss->oracle) {
+        ss->abs_error += ss->tau[index] > actual_fp ? ss->tau[index] - actual_fp : actual_fp - ss->tau[index];
+        ss->actual_sum += actual;
+        ss->predictions++;
+    }
+    ss->tau[index] = (ALPHA_NUM * actual_fp + (ALPHA_DEN - ALPHA_NUM) * ss->tau[index]) / ALPHA_DEN;
+    ss->burst_start[index] = sim->pcb_run_ticks[index];
+}
+
+static void sjf_print_stats(Sim *sim) {
+    SjfState *ss = sim->policy_data;
+
+    if (ss->oracle) {
+        printf("\n[SJF] 오라클: 실제 남은 버스트 기준 (예측 오차 없음)\n");
+    } else {
+        printf("\n[SJF] 예측: 지수 평균 a = %d/%d, 초기값 %.1f틱\n",
+               ALPHA_NUM, ALPHA_DEN, (double)ss->tau0 / (1 << TAU_SHIFT));
+        if (ss->predictions > 0) {
+            double mae = (double)ss->abs_error / (1 << TAU_SHIFT) / ss->predictions;
+            double mean = (double)ss->actual_sum / ss->predictions;
+            printf("[SJF] 예측 오차: 평균 절대 오차 %.2f틱, 실제 평균 버스트 %.2f틱 (상대 오차 %.1f%%, %lld회)\n",
+                   mae, mean, mean > 0 ? mae / mean * 100 : 0.0, ss->predictions);
+        }
+    }
+    if (ss->preemptive) {
+        printf("[SJF] 선점: %lld회\n", ss->preemptions);
+    }
+    printf("[SJF] 최대 힙 크기: %d\n", ss->max_heap);
+}
+
+static void sjf_destroy(Sim *sim) {
+    free(sim->policy_data);
+}
+
+const Policy sjf_policy = {
+    .name = "sjf",
+    .title = "SJF (예측)",
+    .uses_quantum = 0,
+    .init = sjf_init,
+    .admit = sjf_admit,
+    .enqueue = sjf_enqueue,
+    .pick_next = sjf_pick_next,
+    .remove = sjf_remove,
+    .on_io_complete = sjf_on_io_complete,
+    .print_stats = sjf_print_stats,
+    .destroy = sjf_destroy,
+};
+
+const Policy srtf_policy = {
+    .name = "srtf",
+    .title = "SRTF (예측)",
+    .uses_quantum = 1,
+    .init = srtf_init,
+    .admit = sjf_admit,
+    .enqueue = sjf_enqueue,
+    .pick_next = sjf_pick_next,
+    .remove = sjf_remove,
+    .on_quantum_expiry = sjf_on_quantum_expiry,
+    .on_io_complete = sjf_on_io_complete,
+    .print_stats = sjf_print_stats,
+    .destroy = sjf_destroy,
+};
+
+const Policy oracle_policy = {
+    .name = "oracle",
+    .title = "SRTF (오라클)",
+    .uses_quantum = 1,
+    .init = oracle_init,
+    .admit = sjf_admit,
+    .enqueue = sjf_enqueue,
+    .pick_next = sjf_pick_next,
+    .remove = sjf_remove,
+    .on_quantum_expiry = sjf_on_quantum_expiry,
+    .on_io_complete = sjf_on_io_complete,
+    .print_stats = sjf_print_stats,
+    .destroy = sjf_destroy,
+};
@@ -0,0 +1,293 @@
+#ifndef RBTREE_H
+#define RBTREE_H
+
+// 인덱스 기반 레드-블랙 트리 (노드 = 프로세스 인덱스, 키 = key[index], 같은 키는 인덱스 순)
+// left/right/parent/color/key는 프로세스 수만큼의 배열로, 호출자가 할당해 연결 (PCB 저장소의 열)
+// 가장 왼쪽 노드를 캐시해 최소값 조회는 O(1), 삽입/삭제는 O(log n)이고 할당 없음
+#define RB_RED 0
+#define RB_BLACK 1
+
+typedef struct {
+    int root;                   // -1 = 비어있음
+    int leftmost;               // 최소 키 노드 (-1 = 비어있음)
+    int count;
+    int *left;
+    int *right;
+    int *parent;
+    unsigned char *color;
+    long long *key;
+} RBTree;
+
+static inline void rb_init(RBTree *t) {
+    t->root = -1;
+    t->leftmost = -1;
+    t->count = 0;
+}
+
+// a가 b보다 앞이면 1
+static inline int rb_less(const RBTree *t, int a, int b) {
+    return t->key[a] < t->key[b] || (t->key[a] == t->key[b] && a < b);
+}
+
+static inline void rb_rotate_left(RBTree *t, int x) {
+    int y = t->right[x];
+
+    t->right[x] = t->left[y];
+    if (t->left[y] != -1) {
+        t->parent[t->left[y]] = x;
+    }
+    t->parent[y] = t->parent[x];
+    if (t->parent[x] == -1) {
+        t->root = y;
+    } else if (x == t->left[t->parent[x]]) {
+        t->left[t->parent[x]] = y;
+    } else {
+        t->right[t->parent[x]] = y;
+    }
+    t->left[y] = x;
+    t->parent[x] = y;
+}
+
+static inline void rb_rotate_right(RBTree *t, int x) {
+    int y = t->left[x];
+
+    t->left[x] = t->right[y];
+    if (t->right[y] != -1) {
+        t->parent[t->right[y]] = x;
+    }
+    t->parent[y] = t->parent[x];
+    if (t->parent[x] == -1) {
+        t->root = y;
+    } else if (x == t->right[t->parent[x]]) {
+        t->right[t->parent[x]] = y;
+    } else {
+        t->left[t->parent[x]] = y;
+    }
+    t->right[y] = x;
+    t->parent[x] = y;
+}
+
+// key[index]를 먼저 채운 뒤 호출
+static inline void rb_insert(RBTree *t, int index) {
+    int parent = -1;
+    int node = t->root;
+    int is_leftmost = 1;
+
+    while (node != -1) {
+        parent = node;
+        if (rb_less(t, index, node)) {
+            node = t->left[node];
+        } else {
+            node = t->right[node];
+            is_leftmost = 0;
+        }
+    }
+
+    t->parent[index] = parent;
+    t->left[index] = -1;
+    t->right[index] = -1;
+    t->color[index] = RB_RED;
+    if (parent == -1) {
+        t->root = index;
+    } else if (rb_less(t, index, parent)) {
+        t->left[parent] = index;
+    } else {
+        t->right[parent] = index;
+    }
+    if (is_leftmost) {
+        t->leftmost = index;
+    }
+    t->count++;
+
+    // 빨강-빨강 충돌 해소
+    int x = index;
+    while (x != t->root && t->color[t->parent[x]] == RB_RED) {
+        int p = t->parent[x];
+        int g = t->parent[p];
+        if (p == t->left[g]) {
+            int uncle = t->right[g];
+            if (uncle != -1 && t->color[uncle] == RB_RED) {
+                t->color[p] = RB_BLACK;
+                t->color[uncle] = RB_BLACK;
+                t->color[g] = RB_RED;
+                x = g;
+            } else {
+                if (x == t->right[p]) {
+                    x = p;
+                    rb_rotate_left(t, x);
+                    p = t->parent[x];
+                }
+                t->color[p] = RB_BLACK;
+                t->color[g] = RB_RED;
+                rb_rotate_right(t, g);
+            }
+        } else {
+            int uncle = t->left[g];
+            if (uncle != -1 && t->color[uncle] == RB_RED) {
+                t->color[p] = RB_BLACK;
+                t->color[uncle] = RB_BLACK;
+                t->color[g] = RB_RED;
+                x = g;
+            } else {
+                if (x == t->left[p]) {
+                    x = p;
+                    rb_rotate_right(t, x);
+                    p = t->parent[x];
+                }
+                t->color[p] = RB_BLACK;
+                t->color[g] = RB_RED;
+                rb_rotate_left(t, g);
+            }
+        }
+    }
+    t->color[t->root] = RB_BLACK;
+}
+
+// 중위 순회 다음 노드 (없으면 -1)
+static inline int rb_next(const RBTree *t, int x) {
+    if (t->right[x] != -1) {
+        x = t->right[x];
+        while (t->left[x] != -1) {
+            x = t->left[x];
+        }
+        return x;
+    }
+    while (t->parent[x] != -1 && x == t->right[t->parent[x]]) {
+        x = t->parent[x];
+    }
+    return t->parent[x];
+}
+
+// 최대 키 노드 (비어있으면 -1, O(log n))
+static inline int rb_last(const RBTree *t) {
+    int x = t->root;
+
+    while (x != -1 && t->right[x] != -1) {
+        x = t->right[x];
+    }
+    return x;
+}
+
+// u 자리에 v를 연결 (v는 -1일 수 있음)
+static inline void rb_transplant(RBTree *t, int u, int v) {
+    if (t->parent[u] == -1) {
+        t->root = v;
+    } else if (u == t->left[t->parent[u]]) {
+        t->left[t->parent[u]] = v;
+    } else {
+        t->right[t->parent[u]] = v;
+    }
+    if (v != -1) {
+        t->parent[v] = t->parent[u];
+    }
+}
+
+static inline void rb_erase(RBTree *t, int z) {
+    int x, x_parent;
+    unsigned char removed_color = t->color[z];
+
+    if (z == t->leftmost) {
+        t->leftmost = rb_next(t, z);
+    }
+
+    if (t->left[z] == -1) {
+        x = t->right[z];
+        x_parent = t->parent[z];
+        rb_transplant(t, z, x);
+    } else if (t->right[z] == -1) {
+        x = t->left[z];
+        x_parent = t->parent[z];
+        rb_transplant(t, z, x);
+    } else {
+        // 후계자 y(오른쪽 부분 트리의 최소)를 z 자리로 옮김
+        int y = t->right[z];
+        while (t->left[y] != -1) {
+            y = t->left[y];
+        }
+        removed_color = t->color[y];
+        x = t->right[y];
+        if (t->parent[y] == z) {
+            x_parent = y;
+        } else {
+            x_parent = t->parent[y];
+            rb_transplant(t, y, x);
+            t->right[y] = t->right[z];
+            t->parent[t->right[y]] = y;
+        }
+        rb_transplant(t, z, y);
+        t->left[y] = t->left[z];
+        t->parent[t->left[y]] = y;
+        t->color[y] = t->color[z];
+    }
+    t->count--;
+
+    if (removed_color == RB_RED) {
+        return;
+    }
+
+    // 검정 높이 복구 (x는 -1(검정 잎)일 수 있으므로 부모를 따로 추적)
+    while (x != t->root && (x == -1 || t->color[x] == RB_BLACK)) {
+        if (x == t->left[x_parent]) {
+            int w = t->right[x_parent];
+            if (t->color[w] == RB_RED) {
+                t->color[w] = RB_BLACK;
+                t->color[x_parent] = RB_RED;
+                rb_rotate_left(t, x_parent);
+                w = t->right[x_parent];
+            }
+            if ((t->left[w] == -1 || t->color[t->left[w]] == RB_BLACK) &&
+                (t->right[w] == -1 || t->color[t->right[w]] == RB_BLACK)) {
+                t->color[w] = RB_RED;
+                x = x_parent;
+                x_parent = t->parent[x];
+            } else {
+                if (t->right[w] == -1 || t->color[t->right[w]] == RB_BLACK) {
+                    t->color[t->left[w]] = RB_BLACK;
+                    t->color[w] = RB_RED;
+                    rb_rotate_right(t, w);
+                    w = t->right[x_parent];
+                }
+                t->color[w] = t->color[x_parent];
+                t->color[x_parent] = RB_BLACK;
+                if (t->right[w] != -1) {
+                    t->color[t->right[w]] = RB_BLACK;
+                }
+                rb_rotate_left(t, x_parent);
+                x = t->root;
+            }
+        } else {
+            int w = t->left[x_parent];
+            if (t->color[w] == RB_RED) {
+                t->color[w] = RB_BLACK;
+                t->color[x_parent] = RB_RED;
+                rb_rotate_right(t, x_parent);
+                w = t->left[x_parent];
+            }
+            if ((t->right[w] == -1 || t->color[t->right[w]] == RB_BLACK) &&
+                (t->left[w] == -1 || t->color[t->left[w]] == RB_BLACK)) {
+                t->color[w] = RB_RED;
+                x = x_parent;
+                x_parent = t->parent[x];
+            } else {
+                if (t->left[w] == -1 || t->color[t->left[w]] == RB_BLACK) {
+                    t->color[t->right[w]] = RB_BLACK;
+                    t->color[w] = RB_RED;
+                    rb_rotate_left(t, w);
+                    w = t->left[x_parent];
+                }
+                t->color[w] = t->color[x_parent];
+                t->color[x_parent] = RB_BLACK;
+                if (t->left[w] != -1) {
+                    t->color[t->left[w]] = RB_BLACK;
+                }
+                rb_rotate_right(t, x_parent);
+                x = t->root;
+            }
+        }
+    }
+    if (x != -1) {
+        t->color[x] = RB_BLACK;
+    }
+}
+
+#endif
@@ -0,0 +1,1905 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <signal.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <sys/epoll.h>
+#include <sys/timerfd.h>
+#include <sys/signalfd.h>
+#include <sys/syscall.h>
+#include <sys/resource.h>
+#include <sys/mman.h>
+#include <linux/futex.h>
+#include <spawn.h>
+#include <time.h>
+#include <string.h>
+#include <stdint.h>
+#include <errno.h>
+#include <math.h>
+
+#include "sched_engine.h"
+
+extern char **environ;
+
+#define MAX_LOOP_EVENTS 64          // epoll_wait 한 번에 받는 이벤트 수
+#define LOOP_TIMER UINT32_MAX       // epoll 이벤트 태그 (그 외 값 = 자식 pidfd의 PCB 인덱스)
+#define LOOP_SIGCHLD (UINT32_MAX - 1)
+
+// 실시간 틱 모드의 이벤트 루프 상태
+typedef struct {
+    int epoll_fd;
+    int timer_fd;
+    int signal_fd;              // SIGCHLD
+    int *pidfds;                // PCB 인덱스별 pidfd (-1 = 없음 또는 회수됨)
+    int untracked;              // pidfd 없이 살아 있는 자식 수 (SIGCHLD로 회수)
+    sigset_t sigchld_mask;
+    sigset_t saved_mask;
+    long long wakeups;          // 타이머 만료로 깨어난 횟수
+    long long late_wakeups;     // 만료가 2번 이상 쌓여 있던 횟수
+    long long max_batch;        // 한 번에 처리한 최대 틱 수
+    long long start_ns;         // 타이머 시작 시각 (k번째 만료 예정 = start_ns + k × tick_ns)
+    long long tick_ns;
+    long long expirations;      // 지금까지 읽은 만료 수
+} EventLoop;
+
+// 자식 프로세스용 전역 변수
+static volatile int child_should_exit = 0;
+static ChildProbe *child_probe = NULL;      // 자식 자신의 측정 칸
+
+// 시그널 핸들러 (자식 전용)
+static void child_signal_handler(int sig);
+static long long monotonic_ns(void);
+static void collect_probe(Sim *sim, int index);
+
+// 함수 원형
+static int pcb_create(Sim *sim, pid_t pid, int cpu_burst, int priority);
+static void pcb_admit(Sim *sim, int index);
+static void sim_add_process(Sim *sim, int index, pid_t pid, const Workload *workload);
+static int next_arrival(Sim *sim);
+static void admit_arrivals(Sim *sim);
+static void admit_trace_job(Sim *sim);
+static void admit_poisson_job(Sim *sim);
+static void pcb_store_init(Sim *sim, int count);
+static void pcb_store_reserve(Sim *sim, int count);
+static int sim_rand(Sim *sim, int index);
+static void set_state(Sim *sim, int index, enum State state);
+static void make_ready(Sim *sim, int index);
+static void leave_ready(Sim *sim, int index);
+static void schedule_next_process(Sim *sim, int cpu);
+static int migrate(Sim *sim, int from, int to);
+static int steal_task(Sim *sim, int thief);
+static void balance_load(Sim *sim);
+static void finish_process(Sim *sim, int index);
+static int job_exec_time(Sim *sim, int index);
+static void complete_job(Sim *sim, int index);
+static void sim_tick(Sim *sim);
+static void cpu_tick(Sim *sim, int cpu);
+static void record_gantt(Sim *sim, int time);
+static void print_separator(Sim *sim, int time);
+static void format_event(const LogRecord *rec);
+static int ready_count(Sim *sim);
+static long long total_busy_ticks(Sim *sim);
+static void accumulate_ready(Sim *sim, int ticks);
+static void print_interval_header(Sim *sim);
+static void print_interval(Sim *sim);
+static int ticks_until_next_event(Sim *sim);
+static void skip_quiet_ticks(Sim *sim, int ticks);
+static void run_virtual_time(Sim *sim);
+static pid_t spawn_child(Sim *sim, int index, int count);
+static void child_main(ChildProbe *probe, int control, int spin, int real_exec);
+static void signal_child(Sim *sim, int index, int sig);
+static void terminate_child(Sim *sim, int index);
+static void command_child(Sim *sim, int index, unsigned int command);
+static long futex(atomic_uint *word, int op, unsigned int value);
+static void child_follow_commands(ChildProbe *probe, int spin);
+static void run_real_time(Sim *sim);
+static void loop_watch(EventLoop *loop, int fd, uint32_t tag);
+static int open_pidfd(pid_t pid);
+static void loop_open(Sim *sim, EventLoop *loop);
+static void loop_close(Sim *sim, EventLoop *loop);
+static void on_timer(Sim *sim, EventLoop *loop);
+static void on_sigchld(Sim *sim, EventLoop *loop);
+static void export_latency(Sim *sim, const char *path);
+static long long rusage_cpu_us(const struct rusage *usage);
+static void reap_child(Sim *sim, EventLoop *loop, pid_t pid, const struct rusage *usage);
+static void print_deadline_statistics(Sim *sim);
+static void print_cpu_statistics(Sim *sim);
+static void print_exec_statistics(Sim *sim);
+static void print_latency_statistics(Sim *sim);
+
+void sim_init(Sim *sim, const Policy *policy, const SimConfig *config) {
+    memset(sim, 0, sizeof(Sim));
+    sim->policy = policy;
+    sim->config = *config;
+
+    if (config->num_cpus > 1 && policy->steal == NULL) {
+        fprintf(stderr, "%s 정책은 다중 CPU(-c)를 지원하지 않습니다.\n", policy->name);
+        exit(1);
+    }
+    sim->num_cpus = config->num_cpus;
+    sim->cpus = calloc(sim->num_cpus, sizeof(CpuState));
+    if (sim->cpus == NULL) {
+        perror("CPU 상태 할당 실패");
+        exit(1);
+    }
+    for (int cpu = 0; cpu < sim->num_cpus; cpu++) {
+        sim->cpus[cpu].current = -1;
+        sim->cpus[cpu].executed = -1;
+    }
+
+    sim->open = config->job_path != NULL || config->arrival_rate > 0;
+    if (sim->open && !config->virtual_mode) {
+        fprintf(stderr, "작업 트레이스 재생과 포아송 도착은 가상 시간 모드(-v)에서만 지원합니다.\n");
+        exit(1);
+    }
+    if (config->real_exec && config->virtual_mode) {
+        fprintf(stderr, "실제 실행 모드는 실시간 틱 모드에서만 지원합니다.\n");
+        exit(1);
+    }
+    sim->free_head = -1;
+    sim->probe_fd = -1;
+    // 가상 시간 모드는 링이 차면 바로 비워 출력을 빠뜨리지 않음
+    log_open(&sim->log, config->verbose, config->virtual_mode, format_event);
+    // 열린 시스템은 동시에 살아 있는 프로세스 수를 미리 알 수 없으므로 작게 시작해 빈 슬롯이 없을 때만 늘리고,
+    // 간트 로그는 출력 창까지만 기록 (둘 다 실행 시간과 도착한 작업 수에 관계없이 유한)
+    pcb_store_init(sim, sim->open ? JOB_INITIAL_CAPACITY : config->num_processes);
+    sim->gantt_until = INT_MAX;
+    if (sim->open) {
+        sim->gantt_until = config->gantt_to != -1 ? config->gantt_to : config->gantt_from + GANTT_WIDTH - 1;
+    }
+    if (config->trace_path != NULL) {
+        trace_open(&sim->trace, config->trace_path, policy->name, config->num_processes,
+                   policy->uses_quantum ? config->time_quantum : 0, sim->num_cpus, config->virtual_mode);
+    }
+}
+
+// PCB 저장소 초기화: 엔진 열과 정책 열을 등록한 뒤 count개 용량 확보
+// (정책은 init에서 자기 열을 같은 아레나에 등록하므로 확장 시 함께 커짐)
+static void pcb_store_init(Sim *sim, int count) {
+    arena_column(&sim->arena, &sim->pcb_state, sizeof(enum State));
+    arena_column(&sim->arena, &sim->pcb_remaining_quantum, sizeof(int));
+    arena_column(&sim->arena, &sim->pcb_cpu_burst, sizeof(int));
+    arena_column(&sim->arena, &sim->pcb_ready_since, sizeof(int));
+    arena_column(&sim->arena, &sim->pcb_run_ticks, sizeof(int));
+    arena_column(&sim->arena, &sim->pcb_deadline, sizeof(int));
+    arena_column(&sim->arena, &sim->pcb_cpu, sizeof(int));
+    arena_column(&sim->arena, &sim->pcb_last_cpu, sizeof(int));
+    arena_column(&sim->arena, &sim->pcb_penalty, sizeof(int));
+    arena_column(&sim->arena, &sim->pcb_rng, sizeof(unsigned int));
+    arena_column(&sim->arena, &sim->pcb_cold, sizeof(PCBCold));
+    arena_column(&sim->arena, &sim->io_wheel.next, sizeof(int));
+    arena_column(&sim->arena, &sim->io_wheel.prev, sizeof(int));
+    arena_column(&sim->arena, &sim->io_wheel.wake_time, sizeof(int));
+    arena_column(&sim->arena, &sim->wake_buf, sizeof(int));
+    arena_column(&sim->arena, &sim->gantt_logs, sizeof(GanttLog));
+    arena_column(&sim->arena, &sim->gantt_dirty, sizeof(int));
+    arena_column(&sim->arena, &sim->gantt_marked, sizeof(int));
+    arena_column(&sim->arena, &sim->pcb_free_next, sizeof(int));
+    sim->policy->init(sim);
+    tw_init(&sim->io_wheel);
+    pt_init(&sim->pid_index, count);
+    pcb_store_reserve(sim, count);
+}
+
+// 최소 count개의 PCB를 담도록 확장 (아레나가 두 배씩 커지고 pid 테이블도 재해시)
+static void pcb_store_reserve(Sim *sim, int count) {
+    arena_reserve(&sim->arena, count);
+    pt_reserve(&sim->pid_index, count);
+}
+
+// 새 PCB를 만듦 (아직 준비 큐에는 넣지 않음)
+// 빈 슬롯이 있으면 재사용하고 없으면 다음 인덱스에 추가 (닫힌 시스템은 빈 슬롯이 없으므로 작업 부하 순서)
+static int pcb_create(Sim *sim, pid_t pid, int cpu_burst, int priority) {
+    int index = sim->free_head;
+    PCBCold *cold;
+
+    if (index != -1) {
+        // 간트 로그는 슬롯의 타임라인으로 이어서 기록
+        sim->free_head = sim->pcb_free_next[index];
+    } else {
+        index = sim->num_processes;
+        pcb_store_reserve(sim, index + 1);
+        sim->num_processes = index + 1;
+        sim->gantt_logs[index].runs = NULL;
+        sim->gantt_logs[index].count = sim->gantt_logs[index].capacity = 0;
+        sim->gantt_marked[index] = 0;
+    }
+    cold = &sim->pcb_cold[index];
+    if (pid > 0) {
+        pt_insert(&sim->pid_index, pid, index);
+    }
+    cold->pid = pid;
+    sim->pcb_remaining_quantum[index] = sim->config.time_quantum;
+    sim->pcb_cpu_burst[index] = cpu_burst;
+    sim->pcb_run_ticks[index] = 0;
+    sim->pcb_rng[index] = sim->config.seed + (unsigned int)sim->arrivals * 2654435761u;  // 슬롯이 아니라 도착 순번으로
+    cold->wait_time = 0;
+    cold->start_time = sim->current_time;
+    cold->completion_time = -1;
+    cold->first_run = -1;
+    cold->io_woken = 0;
+    cold->initial_priority = priority;
+    cold->period = 0;
+    cold->release = sim->current_time;
+    cold->jobs = cold->misses = cold->max_lateness = 0;
+    cold->script = NULL;
+    cold->script_len = cold->script_pos = 0;
+    cold->granted_ticks = 0;
+    cold->cpu_us = -1;
+    cold->voluntary_switches = cold->involuntary_switches = 0;
+    sim->pcb_state[index] = READY;  // 이전 상태가 RUNNING으로 보이지 않게 (실제 실행 모드의 set_state)
+    sim->pcb_deadline[index] = INT_MAX;
+    sim->pcb_cpu[index] = sim->arrivals % sim->num_cpus;    // 처음에는 CPU에 차례로 배치
+    sim->pcb_last_cpu[index] = -1;
+    sim->pcb_penalty[index] = 0;
+    sim->arrivals++;
+    return index;
+}
+
+// 정책에 알리고 준비 큐에 넣음
+static void pcb_admit(Sim *sim, int index) {
+    sim->live++;
+    if (sim->live > sim->peak_live) {
+        sim->peak_live = sim->live;
+    }
+    sim->interval.arrivals++;
+    if (sim->policy->admit != NULL) {
+        sim->policy->admit(sim, index);
+    }
+    make_ready(sim, index);
+    trace_emit(&sim->trace, TRACE_CREATE, sim->current_time, index, sim->pcb_cpu_burst[index]);
+    trace_drain(&sim->trace);  // 생성 단계는 틱 루프 밖이므로 바로 파일로
+}
+
+// 작업 부하의 프로세스 (작업 부하 순서대로 만들므로 PCB 인덱스 = 작업 부하 인덱스)
+static void sim_add_process(Sim *sim, int index, pid_t pid, const Workload *workload) {
+    PCBCold *cold;
+
+    pcb_create(sim, pid, workload->cpu_burst[index], workload->priority[index]);
+    cold = &sim->pcb_cold[index];
+    if (workload->period != NULL) {
+        cold->period = workload->period[index];
+        cold->wcet = workload->wcet[index];
+        cold->rel_deadline = workload->deadline[index];
+        cold->sporadic = workload->sporadic[index];
+        sim->pcb_deadline[index] = sim->current_time + cold->rel_deadline;
+    }
+    pcb_admit(sim, index);
+}
+
+// 다음 작업의 도착 시간 (-1 = 더 없음, 닫힌 시스템은 항상 -1)
+static int next_arrival(Sim *sim) {
+    if (sim->streaming) {
+        return js_peek(&sim->jobs);
+    }
+    if (sim->config.arrival_rate <= 0 || sim->arrival_clock > INT_MAX / 2 ||
+        (sim->config.num_processes > 0 && sim->arrivals >= sim->config.num_processes)) {
+        return -1;
+    }
+    return (int)ceil(sim->arrival_clock);
+}
+
+// 도착 시간이 지금 이하인 작업을 프로세스로 생성 (도착 순서대로)
+static void admit_arrivals(Sim *sim) {
+    int arrival;
+
+    while ((arrival = next_arrival(sim)) != -1 && arrival <= sim->current_time) {
+        if (sim->streaming) {
+            admit_trace_job(sim);
+        } else {
+            admit_poisson_job(sim);
+        }
+    }
+}
+
+// 작업 트레이스에서 다음 작업을 꺼냄 (버스트와 I/O는 스크립트대로)
+static void admit_trace_job(Sim *sim) {
+    Job job;
+    js_take(&sim->jobs, &job);
+
+    int index = pcb_create(sim, 0, job.script[0], job.priority);
+    PCBCold *cold = &sim->pcb_cold[index];
+    cold->script = job.script;
+    cold->script_len = job.length;
+    cold->script_pos = 1;
+    log_emit(&sim->log, LOG_LIFECYCLE, EVENT_ARRIVAL_JOB, sim->current_time, index, job.script[0], job.priority,
+             (job.length + 1) / 2);
+    pcb_admit(sim, index);
+}
+
+// 포아송 도착: 첫 버스트와 우선순위는 도착 난수열에서, 다음 도착까지의 간격은 지수 분포 (평균 1 / 도착률)
+// (이후 버스트/I/O/종료는 닫힌 시스템과 같이 프로세스별 난수열)
+static void admit_poisson_job(Sim *sim) {
+    int cpu_burst = (rand_r(&sim->arrival_rng) % sim->config.max_burst) + 1;
+    int priority = MIN_PRIORITY + rand_r(&sim->arrival_rng) % (MAX_PRIORITY - MIN_PRIORITY + 1);
+    double u = rand_r(&sim->arrival_rng) / (RAND_MAX + 1.0);
+    int index = pcb_create(sim, 0, cpu_burst, priority);
+
+    sim->arrival_clock += -log(1.0 - u) / sim->config.arrival_rate;
+    log_emit(&sim->log, LOG_LIFECYCLE, EVENT_ARRIVAL, sim->current_time, index, cpu_burst, priority, 0);
+    pcb_admit(sim, index);
+}
+
+// 프로세스별 난수열: 한 프로세스의 버스트/I/O/종료 결정은 다른 프로세스의 실행 순서와 무관
+// (정책마다 스케줄 순서가 달라도 같은 시드면 같은 작업 부하)
+static int sim_rand(Sim *sim, int index) {
+    return rand_r(&sim->pcb_rng[index]);
+}
+
+void sim_run(Sim *sim, const Workload *workload) {
+    // 실시간 태스크: 작업 수 상한 (태스크마다 기간 / 주기 + 1)만큼 지연 기록 공간을 미리 할당
+    // (상한이 정해져 있으므로 작업을 완료할 때마다 늘리지 않음)
+    if (workload->period != NULL) {
+        long long max_jobs = 0;
+        for (int i = 0; i < workload->count; i++) {
+            max_jobs += sim->config.rt_horizon / workload->period[i] + 1;
+        }
+        sim->lateness = malloc(sizeof(int) * max_jobs);
+        if (sim->lateness == NULL) {
+            perror("작업 지연 기록 할당 실패");
+            exit(1);
+        }
+    }
+
+    if (!sim->config.virtual_mode) {
+        // fork 전에 공유 매핑을 만들어 두면 자식도 같은 칸을 봄 (posix_spawn은 memfd를 물려받아 매핑)
+        size_t size = sizeof(ChildProbe) * (workload->count > 0 ? workload->count : 1);
+        if (sim->config.spawn == SPAWN_POSIX) {
+            sim->probe_fd = (int)syscall(SYS_memfd_create, "sched-probes", 0);
+            if (sim->probe_fd == -1 || ftruncate(sim->probe_fd, (off_t)size) != 0) {
+                perror("자식 공유 메모리 생성 실패");
+                exit(1);
+            }
+        }
+        sim->probes = mmap(NULL, size, PROT_READ | PROT_WRITE,
+                           MAP_SHARED | (sim->probe_fd == -1 ? MAP_ANONYMOUS : 0), sim->probe_fd, 0);
+        if (sim->probes == MAP_FAILED) {
+            perror("측정 공유 메모리 할당 실패");
+            exit(1);
+        }
+    }
+
+    for (int i = 0; i < workload->count; i++) {
+        pid_t pid = 0;
+
+        if (!sim->config.virtual_mode) {
+            long long begin = monotonic_ns();
+            pid = spawn_child(sim, i, workload->count);
+            sim->exec.spawn_ns += monotonic_ns() - begin;
+        }
+
+        // 가상 시간 모드: 자식 프로세스 없이 PCB만 생성
+        sim_add_process(sim, i, pid, workload);
+        if (sim->config.verbose && i < MAX_PRINT_PROCESSES) {
+            if (workload->period != NULL) {
+                printf("[태스크 %d] 주기 %d, WCET %d, 데드라인 %d%s, 첫 작업 %d틱으로 생성됨\n",
+                       i, workload->period[i], workload->wcet[i], workload->deadline[i],
+                       workload->sporadic[i] ? " (산발적)" : "", workload->cpu_burst[i]);
+            } else {
+                printf("[프로세스 %d] CPU 버스트 %d, 우선순위 %d로 생성됨\n",
+                       i, workload->cpu_burst[i], workload->priority[i]);
+            }
+        }
+    }
+    if (sim->config.verbose && workload->count > MAX_PRINT_PROCESSES) {
+        printf("... (외 %d개 프로세스 생략)\n", workload->count - MAX_PRINT_PROCESSES);
+    }
+    if (sim->probe_fd != -1) {
+        close(sim->probe_fd);   // 자식이 모두 매핑함
+    }
+
+    if (sim->open) {
+        // 열린 시스템: 시간 0에 도착한 작업부터 만들고 나머지는 도착 시간에 맞춰 생성
+        // (포아송 도착 난수열은 시드로 정해 모든 정책이 같은 도착 순서를 받음)
+        if (sim->config.job_path != NULL) {
+            js_open(&sim->jobs, sim->config.job_path, sim->config.time_scale);
+            sim->streaming = 1;
+        } else {
+            sim->arrival_rng = sim->config.seed ^ 0x5bd1e995u;
+        }
+        if (sim->config.report_interval > 0) {
+            print_interval_header(sim);
+        }
+        admit_arrivals(sim);
+    }
+
+    if (sim->config.virtual_mode) {
+        // 타이머 없이 이벤트 단위로 시뮬레이션
+        for (int cpu = 0; cpu < sim->num_cpus; cpu++) {
+            schedule_next_process(sim, cpu);
+        }
+        run_virtual_time(sim);
+    } else {
+        run_real_time(sim);
+    }
+    if (sim->streaming) {
+        js_close(&sim->jobs);
+        sim->streaming = 0;
+    }
+    log_close(&sim->log);
+    trace_close(&sim->trace, sim->current_time, sim->num_processes);
+}
+
+// 자식 프로세스 생성
+// - 실시간 틱 모드: 틱마다 SIGUSR1을 받기만 하고 SIGTERM을 받으면 종료
+//   (공유 메모리 제어 채널이면 시그널 대신 명령 번호를 기다림)
+// - 실제 실행 모드: CPU를 계속 쓰는 작업을 돌리고, 부모가 SIGSTOP/SIGCONT로 실행 여부를 정함
+//   (정지한 것을 확인한 뒤 반환하므로 첫 디스패치 전에는 CPU를 쓰지 않음, SIGTERM 기본 동작으로 종료)
+// fork는 부모 주소 공간(페이지 테이블)을 복사하므로 부모가 크거나 자식이 많으면 느림,
+// posix_spawn은 주소 공간 복사 없이(vfork 방식) 이 실행 파일을 자식 모드로 다시 실행하고
+// 자식은 상속받은 memfd로 같은 제어/측정 칸을 매핑함
+static pid_t spawn_child(Sim *sim, int index, int count) {
+    pid_t pid;
+
+    if (sim->config.spawn == SPAWN_POSIX) {
+        char fd_arg[16], index_arg[16], count_arg[16], control_arg[16], spin_arg[16], exec_arg[16];
+        char *argv[] = { "scheduler", CHILD_ARG, fd_arg, index_arg, count_arg, control_arg, spin_arg, exec_arg, NULL };
+        int error;
+
+        snprintf(fd_arg, sizeof(fd_arg), "%d", sim->probe_fd);
+        snprintf(index_arg, sizeof(index_arg), "%d", index);
+        snprintf(count_arg, sizeof(count_arg), "%d", count);
+        snprintf(control_arg, sizeof(control_arg), "%d", sim->config.control);
+        snprintf(spin_arg, sizeof(spin_arg), "%d", sim->config.spin);
+        snprintf(exec_arg, sizeof(exec_arg), "%d", sim->config.real_exec);
+        error = posix_spawn(&pid, "/proc/self/exe", NULL, NULL, argv, environ);
+        if (error != 0) {
+            errno = error;
+            perror("posix_spawn 실패");
+            exit(1);
+        }
+    } else {
+        fflush(stdout);  // fork 전에 버퍼 비우기
+        pid = fork();
+        if (pid == 0) {
+            child_main(&sim->probes[index], sim->config.control, sim->config.spin, sim->config.real_exec);
+        } else if (pid < 0) {
+            perror("Fork 실패");
+            exit(1);
+        }
+    }
+
+    if (sim->config.real_exec) {
+        int status;
+        kill(pid, SIGSTOP);
+        if (waitpid(pid, &status, WUNTRACED) != pid || !WIFSTOPPED(status)) {
+            perror("자식 정지 확인 실패");
+            exit(1);
+        }
+    }
+    return pid;
+}
+
+// 자식 프로세스 코드 (반환하지 않음)
+static void child_main(ChildProbe *probe, int control, int spin, int real_exec) {
+    if (real_exec) {
+        volatile unsigned long work = 0;
+        for (;;) {
+            work = work * 6364136223846793005UL + 1442695040888963407UL;
+        }
+    }
+
+    if (control == CONTROL_FUTEX) {
+        child_follow_commands(probe, spin);
+        exit(0);
+    }
+
+    // 단순히 시그널 대기만 함
+    sigset_t wait_mask, child_mask;
+    child_probe = probe;
+    sigemptyset(&child_mask);
+    sigaddset(&child_mask, SIGUSR1);
+    sigaddset(&child_mask, SIGTERM);
+    sigprocmask(SIG_BLOCK, &child_mask, &wait_mask);
+    sigdelset(&wait_mask, SIGUSR1);
+    sigdelset(&wait_mask, SIGTERM);
+    signal(SIGUSR1, child_signal_handler);
+    signal(SIGTERM, child_signal_handler);
+
+    // 스케줄링 시그널 대기 (플래그 확인과 대기 사이에 온 SIGTERM을 놓치지 않도록 sigsuspend)
+    while (!child_should_exit) {
+        sigsuspend(&wait_mask);
+    }
+
+    exit(0);
+}
+
+// posix_spawn으로 다시 실행된 자식의 진입점: argv = CHILD_ARG memfd 인덱스 칸수 제어 확인횟수 실제실행
+int sim_child_main(int argc, char *argv[]) {
+    if (argc != 8) {
+        fprintf(stderr, "자식 모드 인자가 잘못되었습니다.\n");
+        return 1;
+    }
+    int fd = atoi(argv[2]);
+    int index = atoi(argv[3]);
+    int count = atoi(argv[4]);
+    ChildProbe *probes = mmap(NULL, sizeof(ChildProbe) * (count > 0 ? count : 1),
+                              PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (probes == MAP_FAILED || index < 0 || index >= count) {
+        perror("자식 공유 메모리 매핑 실패");
+        return 1;
+    }
+    close(fd);
+    child_main(&probes[index], atoi(argv[5]), atoi(argv[6]), atoi(argv[7]));
+    return 0;
+}
+
+// 자식에게 SIGSTOP/SIGCONT (실제 실행 모드에서 디스패치/선점을 실제 실행에 반영)
+static void signal_child(Sim *sim, int index, int sig) {
+    kill(sim->pcb_cold[index].pid, sig);
+    sim->exec.signals++;
+}
+
+// 스케줄러가 끝낸 프로세스의 자식 종료 요청 (회수는 pidfd/SIGCHLD에서)
+static void terminate_child(Sim *sim, int index) {
+    if (sim->config.virtual_mode) {
+        return;
+    }
+    if (sim->config.control == CONTROL_FUTEX) {
+        command_child(sim, index, CHILD_EXIT);
+        return;
+    }
+    kill(sim->pcb_cold[index].pid, SIGTERM);
+    if (sim->config.real_exec) {
+        kill(sim->pcb_cold[index].pid, SIGCONT);   // 정지 상태면 SIGTERM이 전달되도록
+    }
+}
+
+// 실행 중인 자식에게 명령 전달 (전달 지연 측정용 전송 시각을 먼저 기록)
+// - 시그널: RUN = SIGUSR1, EXIT = SIGTERM (틱마다 시스템 콜 + 시그널 전달)
+// - futex: 명령을 쓰고 번호를 올린 뒤, 자식이 잠들어 있을 때만 FUTEX_WAKE
+//   (자식: parked = 1 후 번호 재확인, 부모: 번호 증가 후 parked 확인 - 둘 다 seq_cst라 깨우기를 놓치지 않음)
+static void command_child(Sim *sim, int index, unsigned int command) {
+    ChildProbe *probe = &sim->probes[index];
+
+    collect_probe(sim, index);
+    atomic_store_explicit(&probe->sent_ns, monotonic_ns(), memory_order_release);
+    sim->exec.commands++;
+    if (sim->config.control == CONTROL_SIGNAL) {
+        kill(sim->pcb_cold[index].pid, command == CHILD_EXIT ? SIGTERM : SIGUSR1);
+        return;
+    }
+    atomic_store_explicit(&probe->command, command, memory_order_relaxed);
+    atomic_fetch_add(&probe->seq, 1);
+    if (atomic_load(&probe->parked)) {
+        futex(&probe->seq, FUTEX_WAKE, 1);
+        sim->exec.wakes++;
+    }
+}
+
+// 프로세스 사이에서 공유하는 매핑이므로 FUTEX_PRIVATE_FLAG 없이
+static long futex(atomic_uint *word, int op, unsigned int value) {
+    return syscall(SYS_futex, word, op, value, NULL, NULL, 0);
+}
+
+// 자식: 명령 번호가 바뀔 때까지 spin번 확인한 뒤 futex로 잠듦, EXIT 명령이면 반환
+static void child_follow_commands(ChildProbe *probe, int spin) {
+    unsigned int seen = 0;
+
+    for (;;) {
+        unsigned int seq = atomic_load(&probe->seq);
+        for (int k = 0; seq == seen && k < spin; k++) {
+#if defined(__x86_64__) || defined(__i386__)
+            __builtin_ia32_pause();
+#endif
+            seq = atomic_load_explicit(&probe->seq, memory_order_acquire);
+        }
+        if (seq == seen) {
+            atomic_store(&probe->parked, 1);
+            if (atomic_load(&probe->seq) == seen) {
+                futex(&probe->seq, FUTEX_WAIT, seen);   // 그 사이 번호가 바뀌었으면 바로 반환
+            }
+            atomic_store(&probe->parked, 0);
+            continue;
+        }
+        seen = seq;
+
+        long long sent = atomic_load_explicit(&probe->sent_ns, memory_order_acquire);
+        atomic_store_explicit(&probe->delivery_ns, monotonic_ns() - sent, memory_order_relaxed);
+        atomic_fetch_add_explicit(&probe->acked, 1, memory_order_release);
+        if (atomic_load_explicit(&probe->command, memory_order_relaxed) == CHILD_EXIT) {
+            return;
+        }
+    }
+}
+
+// 실시간 틱 모드: 시그널 핸들러 없이 epoll 하나로 틱(timerfd)과 자식 종료(pidfd, SIGCHLD의 signalfd)를 기다림
+// 스케줄링은 모두 보통 함수 문맥에서 실행되고, 루프가 늦어 만료가 쌓이면 밀린 틱을 한꺼번에 처리
+static void run_real_time(Sim *sim) {
+    EventLoop loop;
+    struct rusage usage_begin, usage_end;
+    struct epoll_event events[MAX_LOOP_EVENTS];
+
+    loop_open(sim, &loop);
+
+    // 잠시 대기하여 자식 프로세스들이 초기화되도록 함
+    usleep(50000);
+    getrusage(RUSAGE_SELF, &usage_begin);
+
+    // 스케줄링 시작
+    for (int cpu = 0; cpu < sim->num_cpus; cpu++) {
+        schedule_next_process(sim, cpu);
+    }
+
+    // 타이머 시작 (기본 100ms 간격, 만료 예정 시각을 알 수 있게 절대 시각으로)
+    struct itimerspec timer;
+    loop.tick_ns = sim->config.tick_us * 1000LL;
+    loop.start_ns = monotonic_ns();
+    timer.it_interval.tv_sec = loop.tick_ns / 1000000000LL;
+    timer.it_interval.tv_nsec = loop.tick_ns % 1000000000LL;
+    timer.it_value.tv_sec = (loop.start_ns + loop.tick_ns) / 1000000000LL;
+    timer.it_value.tv_nsec = (loop.start_ns + loop.tick_ns) % 1000000000LL;
+    timerfd_settime(loop.timer_fd, TFD_TIMER_ABSTIME, &timer, NULL);
+
+    // 모든 자식 프로세스 완료 대기
+    while (sim->completed_processes < sim->num_processes) {
+        int count = epoll_wait(loop.epoll_fd, events, MAX_LOOP_EVENTS, -1);
+        if (count == -1) {
+            if (errno == EINTR) {
+                continue;
+            }
+            perror("epoll_wait 실패");
+            exit(1);
+        }
+        for (int k = 0; k < count && sim->completed_processes < sim->num_processes; k++) {
+            uint32_t tag = events[k].data.u32;
+            if (tag == LOOP_TIMER) {
+                on_timer(sim, &loop);
+            } else if (tag == LOOP_SIGCHLD) {
+                on_sigchld(sim, &loop);
+            } else if (loop.pidfds[tag] != -1) {
+                // pidfd가 읽기 가능 = 그 자식이 종료됨
+                struct rusage usage;
+                if (wait4(sim->pcb_cold[tag].pid, NULL, WNOHANG, &usage) > 0) {
+                    reap_child(sim, &loop, sim->pcb_cold[tag].pid, &usage);
+                }
+            }
+        }
+        trace_drain(&sim->trace);
+        log_drain(&sim->log);   // 틱 처리가 쌓은 이벤트는 여기서만 출력
+    }
+    getrusage(RUSAGE_SELF, &usage_end);
+    sim->exec.parent_cpu_us = rusage_cpu_us(&usage_end) - rusage_cpu_us(&usage_begin);
+
+    if (sim->config.verbose) {
+        printf("\n[실시간] %d틱, 타이머 깨어남 %lld회, 밀린 만료를 한꺼번에 처리 %lld회 (최대 %lld틱)\n",
+               sim->current_time, loop.wakeups, loop.late_wakeups, loop.max_batch);
+    }
+
+    // 남은 자식을 모두 회수해 다음 정책 실행과 섞이지 않게 함 (모두 SIGTERM을 받은 상태)
+    loop_close(sim, &loop);
+    for (int i = 0; i < sim->num_processes; i++) {
+        collect_probe(sim, i);
+    }
+    if (sim->config.latency_path != NULL) {
+        export_latency(sim, sim->config.latency_path);
+    }
+}
+
+static long long monotonic_ns(void) {
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000000000LL + ts.tv_nsec;
+}
+
+// 지연 히스토그램을 CSV로 (히스토그램,하한ns,상한ns,개수)
+static void export_latency(Sim *sim, const char *path) {
+    FILE *out = fopen(path, "w");
+
+    if (out == NULL) {
+        perror("지연 히스토그램 파일 열기 실패");
+        return;
+    }
+    fprintf(out, "histogram,lower_ns,upper_ns,count\n");
+    hist_export(out, "delivery", &sim->latency.delivery);
+    hist_export(out, "jitter", &sim->latency.jitter);
+    hist_export(out, "tick_work", &sim->latency.tick_work);
+    fclose(out);
+}
+
+// epoll 인스턴스에 fd 등록 (tag = LOOP_TIMER, LOOP_SIGCHLD 또는 자식의 PCB 인덱스)
+static void loop_watch(EventLoop *loop, int fd, uint32_t tag) {
+    struct epoll_event ev;
+
+    memset(&ev, 0, sizeof(ev));
+    ev.events = EPOLLIN;
+    ev.data.u32 = tag;
+    if (epoll_ctl(loop->epoll_fd, EPOLL_CTL_ADD, fd, &ev) == -1) {
+        perror("epoll 등록 실패");
+        exit(1);
+    }
+}
+
+static int open_pidfd(pid_t pid) {
+#ifdef SYS_pidfd_open
+    return (int)syscall(SYS_pidfd_open, pid, 0);
+#else
+    errno = ENOSYS;
+    return -1;
+#endif
+}
+
+// SIGCHLD는 블록하고 signalfd로만 받음, 자식마다 pidfd (pidfd를 못 여는 커널이면 SIGCHLD로 회수)
+static void loop_open(Sim *sim, EventLoop *loop) {
+    memset(loop, 0, sizeof(EventLoop));
+    sigemptyset(&loop->sigchld_mask);
+    sigaddset(&loop->sigchld_mask, SIGCHLD);
+    sigprocmask(SIG_BLOCK, &loop->sigchld_mask, &loop->saved_mask);
+
+    loop->epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+    loop->timer_fd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+    loop->signal_fd = signalfd(-1, &loop->sigchld_mask, SFD_NONBLOCK | SFD_CLOEXEC);
+    loop->pidfds = malloc(sizeof(int) * (sim->num_processes > 0 ? sim->num_processes : 1));
+    if (loop->epoll_fd == -1 || loop->timer_fd == -1 || loop->signal_fd == -1 || loop->pidfds == NULL) {
+        perror("이벤트 루프 설정 실패");
+        exit(1);
+    }
+    loop_watch(loop, loop->timer_fd, LOOP_TIMER);
+    loop_watch(loop, loop->signal_fd, LOOP_SIGCHLD);
+
+    for (int i = 0; i < sim->num_processes; i++) {
+        loop->pidfds[i] = open_pidfd(sim->pcb_cold[i].pid);
+        if (loop->pidfds[i] == -1) {
+            loop->untracked++;
+            continue;
+        }
+        loop_watch(loop, loop->pidfds[i], (uint32_t)i);
+    }
+}
+
+static void loop_close(Sim *sim, EventLoop *loop) {
+    struct rusage usage;
+    pid_t pid;
+
+    close(loop->timer_fd);  // 타이머 정지
+    while ((pid = wait4(-1, NULL, 0, &usage)) > 0) {
+        reap_child(sim, loop, pid, &usage);
+    }
+    for (int i = 0; i < sim->num_processes; i++) {
+        if (loop->pidfds[i] != -1) {
+            close(loop->pidfds[i]);
+        }
+    }
+    free(loop->pidfds);
+    close(loop->signal_fd);
+    close(loop->epoll_fd);
+    sigprocmask(SIG_SETMASK, &loop->saved_mask, NULL);  // 쌓인 SIGCHLD는 기본 동작(무시)으로 버려짐
+}
+
+// 타이머 만료: 지난 read 이후 만료 횟수만큼 틱 진행 (루프가 늦어도 틱을 잃지 않음)
+static void on_timer(Sim *sim, EventLoop *loop) {
+    uint64_t expirations;
+
+    if (read(loop->timer_fd, &expirations, sizeof(expirations)) != sizeof(expirations)) {
+        return;     // 다른 이벤트를 처리하는 사이에 이미 읽음
+    }
+    // 지터 = 가장 최근 만료 예정 시각부터 지금까지 (밀린 만료는 max_batch로 따로 셈)
+    loop->expirations += (long long)expirations;
+    hist_record(&sim->latency.jitter, monotonic_ns() - (loop->start_ns + loop->expirations * loop->tick_ns));
+    loop->wakeups++;
+    if (expirations > 1) {
+        loop->late_wakeups++;
+    }
+    if ((long long)expirations > loop->max_batch) {
+        loop->max_batch = (long long)expirations;
+    }
+    for (uint64_t k = 0; k < expirations && sim->completed_processes < sim->num_processes; k++) {
+        long long begin = monotonic_ns();
+        sim_tick(sim);
+        hist_record(&sim->latency.tick_work, monotonic_ns() - begin);
+        trace_drain(&sim->trace);
+    }
+}
+
+// SIGCHLD: signalfd를 비우고, pidfd 없이 생성된 자식이 있을 때만 전부 훑어 회수
+static void on_sigchld(Sim *sim, EventLoop *loop) {
+    struct signalfd_siginfo info;
+    struct rusage usage;
+    pid_t pid;
+
+    while (read(loop->signal_fd, &info, sizeof(info)) == sizeof(info)) {
+    }
+    if (loop->untracked == 0) {
+        return;     // pidfd 이벤트로 회수
+    }
+    while ((pid = wait4(-1, NULL, WNOHANG, &usage)) > 0) {
+        reap_child(sim, loop, pid, &usage);
+    }
+}
+
+static long long rusage_cpu_us(const struct rusage *usage) {
+    return (usage->ru_utime.tv_sec + usage->ru_stime.tv_sec) * 1000000LL +
+           usage->ru_utime.tv_usec + usage->ru_stime.tv_usec;
+}
+
+// 회수한 자식의 PCB를 pid로 찾아 정리 (스케줄러가 종료시키지 않은 자식, 즉 외부에서 종료된 경우만 DONE 처리)
+// 자식이 실제로 쓴 CPU 시간과 문맥 교환 횟수는 wait4의 rusage에서
+static void reap_child(Sim *sim, EventLoop *loop, pid_t pid, const struct rusage *usage) {
+    int index = pt_lookup(&sim->pid_index, pid);
+
+    if (index == -1) {
+        return;
+    }
+    pt_remove(&sim->pid_index, pid);  // 회수된 pid는 재사용될 수 있으므로 제거
+    sim->pcb_cold[index].cpu_us = rusage_cpu_us(usage);
+    sim->pcb_cold[index].voluntary_switches = usage->ru_nvcsw;
+    sim->pcb_cold[index].involuntary_switches = usage->ru_nivcsw;
+    if (loop->pidfds[index] != -1) {
+        close(loop->pidfds[index]);   // 닫으면 epoll에서도 빠짐
+        loop->pidfds[index] = -1;
+    } else {
+        loop->untracked--;
+    }
+
+    if (sim->pcb_state[index] != DONE) {
+        if (sim->pcb_state[index] == READY) {
+            leave_ready(sim, index);
+            if (sim->policy->remove != NULL) {
+                sim->policy->remove(sim, index);
+            }
+            sim->cpus[sim->pcb_cpu[index]].nr_ready--;
+        } else if (sim->pcb_state[index] == SLEEP) {
+            tw_remove(&sim->io_wheel, index);
+        }
+        finish_process(sim, index);
+        int cpu = sim->pcb_cpu[index];
+        if (sim->cpus[cpu].current == index) {
+            sim->cpus[cpu].current = -1;
+            schedule_next_process(sim, cpu);
+        }
+    }
+}
+
+// clock_gettime과 원자적 저장만 하므로 핸들러에서 호출해도 안전
+static void child_signal_handler(int sig) {
+    if (sig == SIGTERM) {
+        child_should_exit = 1;
+    } else if (child_probe != NULL) {
+        // SIGUSR1은 단순히 "실행 중"임을 나타내는 용도로만 사용 (받은 시각만 부모에게 알림)
+        long long sent = atomic_load_explicit(&child_probe->sent_ns, memory_order_acquire);
+        atomic_store_explicit(&child_probe->delivery_ns, monotonic_ns() - sent, memory_order_relaxed);
+        atomic_fetch_add_explicit(&child_probe->acked, 1, memory_order_release);
+    }
+}
+
+// 자식이 지난번 수집 이후 기록한 전달 지연을 히스토그램에 넣음
+static void collect_probe(Sim *sim, int index) {
+    ChildProbe *probe = &sim->probes[index];
+    unsigned int acked = atomic_load_explicit(&probe->acked, memory_order_acquire);
+
+    if (acked != probe->collected) {
+        hist_record(&sim->latency.delivery, atomic_load_explicit(&probe->delivery_ns, memory_order_relaxed));
+        probe->collected = acked;
+    }
+}
+
+// 한 틱 처리 (실시간 모드의 타이머 만료, 가상 시간 모드 공용)
+static void sim_tick(Sim *sim) {
+    const Policy *policy = sim->policy;
+
+    sim->current_time++;
+    if (policy->on_tick != NULL) {
+        policy->on_tick(sim);
+    }
+    print_separator(sim, sim->current_time);
+
+    // I/O 완료 확인 (이번 틱에 깨어나는 프로세스만, 인덱스 순, 마지막으로 실행한 CPU의 준비 큐로)
+    int woken = tw_expire(&sim->io_wheel, sim->current_time, sim->wake_buf);
+    for (int k = 0; k < woken; k++) {
+        int i = sim->wake_buf[k];
+        log_emit(&sim->log, LOG_DETAIL, EVENT_IO_DONE, sim->current_time, i, 0, 0, 0);
+        if (policy->on_io_complete != NULL) {
+            policy->on_io_complete(sim, i);
+        }
+        sim->pcb_cold[i].io_woken = 1;
+        make_ready(sim, i);
+        trace_emit(&sim->trace, TRACE_WAKE, sim->current_time, i, 0);
+    }
+    admit_arrivals(sim);
+
+    if (sim->num_cpus > 1 && sim->current_time % BALANCE_INTERVAL == 0) {
+        balance_load(sim);
+    }
+    for (int cpu = 0; cpu < sim->num_cpus; cpu++) {
+        cpu_tick(sim, cpu);
+    }
+
+    // 간트 차트 기록 (모든 상태 변경 후, 이번 틱에 실제로 실행한 프로세스 기준)
+    record_gantt(sim, sim->current_time);
+
+    // 열린 시스템: 틱 끝의 준비 큐 길이를 누적하고 보고 간격마다 구간 통계 출력
+    if (sim->open) {
+        accumulate_ready(sim, 1);
+        if (sim->config.report_interval > 0 && sim->current_time % sim->config.report_interval == 0) {
+            print_interval(sim);
+        }
+    }
+}
+
+// CPU 하나의 틱: 실행 중인 프로세스를 한 틱 진행하고, 나가면 다음 프로세스 디스패치
+static void cpu_tick(Sim *sim, int cpu) {
+    const Policy *policy = sim->policy;
+    CpuState *c = &sim->cpus[cpu];
+    int p = c->current;
+
+    sim->current_cpu = cpu;
+    c->executed = -1;
+    if (p != -1 && sim->pcb_state[p] == RUNNING) {
+        c->executed = p;
+        c->busy_ticks++;
+
+        // 자식에게 시그널 보내서 CPU 버스트 실행 (실제 실행 모드는 SIGCONT 이후 계속 실행 중)
+        if (!sim->config.virtual_mode && !sim->config.real_exec) {
+            command_child(sim, p, CHILD_RUN);
+        }
+        sim->pcb_cold[p].granted_ticks++;
+
+        // 부모측에서 CPU 버스트와 타임 퀀텀 감소 (이주 직후에는 캐시 워밍업으로 버스트 진행 없음)
+        if (sim->pcb_penalty[p] > 0) {
+            sim->pcb_penalty[p]--;
+            c->penalty_ticks++;
+        } else {
+            sim->pcb_cpu_burst[p]--;
+            sim->pcb_run_ticks[p]++;
+        }
+        if (policy->uses_quantum) {
+            sim->pcb_remaining_quantum[p]--;
+        }
+
+        // CPU 버스트가 0이 되면 프로세스 종료 또는 I/O (실시간 태스크는 작업 완료)
+        if (sim->pcb_cpu_burst[p] <= 0) {
+            PCBCold *cold = &sim->pcb_cold[p];
+            if (cold->period > 0) {
+                complete_job(sim, p);
+            } else if (cold->script != NULL ? cold->script_pos >= cold->script_len : sim_rand(sim, p) % 2 == 0) {
+                // 바로 DONE 처리하고 SIGTERM으로 자식 종료 유도 (회수는 pidfd/SIGCHLD에서)
+                finish_process(sim, p);
+                terminate_child(sim, p);
+            } else {
+                // I/O 요청 (트레이스 재생이면 스크립트의 다음 I/O 시간과 CPU 버스트)
+                int io_time;
+                if (cold->script != NULL) {
+                    io_time = cold->script[cold->script_pos];
+                } else {
+                    io_time = (sim_rand(sim, p) % sim->config.max_io) + 1;
+                }
+                log_emit(&sim->log, LOG_DETAIL, EVENT_IO_REQUEST, sim->current_time, p, io_time, 0, 0);
+                set_state(sim, p, SLEEP);
+                tw_add(&sim->io_wheel, p, sim->current_time + io_time);
+                trace_emit(&sim->trace, TRACE_SLEEP, sim->current_time, p, sim->current_time + io_time);
+                if (cold->script != NULL) {
+                    sim->pcb_cpu_burst[p] = cold->script[cold->script_pos + 1];
+                    cold->script_pos += 2;
+                } else {
+                    sim->pcb_cpu_burst[p] = (sim_rand(sim, p) % sim->config.max_burst) + 1;
+                }
+            }
+            c->current = -1;
+            schedule_next_process(sim, cpu);
+        }
+        // 타임 퀀텀 만료 확인
+        else if (policy->uses_quantum && sim->pcb_remaining_quantum[p] <= 0) {
+            log_emit(&sim->log, LOG_DETAIL, EVENT_QUANTUM, sim->current_time, p, 0, 0, 0);
+            if (policy->on_quantum_expiry != NULL) {
+                policy->on_quantum_expiry(sim, p);
+            }
+            make_ready(sim, p);
+            trace_emit(&sim->trace, TRACE_PREEMPT, sim->current_time, p, 0);
+            c->current = -1;
+            schedule_next_process(sim, cpu);
+        }
+    } else {
+        // 현재 실행 중인 프로세스가 없으면 스케줄링 시도
+        schedule_next_process(sim, cpu);
+    }
+}
+
+static void finish_process(Sim *sim, int index) {
+    PCBCold *cold = &sim->pcb_cold[index];
+    int turnaround = sim->current_time - cold->start_time;
+
+    if (cold->script != NULL) {
+        free(cold->script);
+        cold->script = NULL;
+    }
+    set_state(sim, index, DONE);
+    cold->completion_time = sim->current_time;
+    trace_emit(&sim->trace, TRACE_EXIT, sim->current_time, index, 0);
+    sim->completed_processes++;
+    sim->live--;
+
+    // 슬롯이 재사용돼도 남도록 통계는 여기서 누적
+    sim->total_wait += cold->wait_time;
+    sim->total_turnaround += turnaround;
+    sim->total_response += cold->first_run - cold->start_time;
+    sim->interval.completions++;
+    sim->interval.turnaround += turnaround;
+    if (turnaround > sim->interval.max_turnaround) {
+        sim->interval.max_turnaround = turnaround;
+    }
+
+    if (sim->open) {
+        log_emit(&sim->log, LOG_LIFECYCLE, EVENT_EXIT_OPEN, sim->current_time, index, sim->completed_processes,
+                 sim->live, 0);
+    } else {
+        log_emit(&sim->log, LOG_LIFECYCLE, EVENT_EXIT, sim->current_time, index, sim->completed_processes,
+                 sim->num_processes, 0);
+    }
+    // 열린 시스템: 슬롯을 빈 슬롯 목록에 돌려줌 (최근에 쓴 슬롯부터 재사용해 캐시에 남아 있는 열을 씀)
+    if (sim->open) {
+        sim->pcb_free_next[index] = sim->free_head;
+        sim->free_head = index;
+    }
+}
+
+// 작업 실행 시간: WCET의 절반 이상 WCET 이하 (모든 작업이 WCET를 넘지 않음)
+static int job_exec_time(Sim *sim, int index) {
+    int wcet = sim->pcb_cold[index].wcet;
+    return wcet - sim_rand(sim, index) % ((wcet + 1) / 2);
+}
+
+// 실시간 작업 완료: 지연 기록 후 다음 릴리스까지 잠들거나 (이미 지났으면 바로 READY) 기간이 끝났으면 종료
+static void complete_job(Sim *sim, int index) {
+    PCBCold *cold = &sim->pcb_cold[index];
+    int lateness = sim->current_time - sim->pcb_deadline[index];
+
+    sim->lateness[sim->lateness_count++] = lateness;
+    if (cold->jobs == 0 || lateness > cold->max_lateness) {
+        cold->max_lateness = lateness;
+    }
+    cold->jobs++;
+    if (lateness > 0) {
+        cold->misses++;
+    }
+    log_emit(&sim->log, LOG_LIFECYCLE, EVENT_JOB_DONE, sim->current_time, index, sim->pcb_deadline[index],
+             lateness, 0);
+
+    int next = cold->release + cold->period;
+    if (cold->sporadic) {
+        next += sim_rand(sim, index) % (cold->period / 2 + 1);
+    }
+    if (next >= sim->config.rt_horizon) {
+        finish_process(sim, index);
+        terminate_child(sim, index);
+        return;
+    }
+    cold->release = next;
+    sim->pcb_deadline[index] = next + cold->rel_deadline;
+    sim->pcb_cpu_burst[index] = job_exec_time(sim, index);
+    if (next <= sim->current_time) {
+        make_ready(sim, index);
+        trace_emit(&sim->trace, TRACE_WAKE, sim->current_time, index, 0);
+    } else {
+        set_state(sim, index, SLEEP);
+        tw_add(&sim->io_wheel, index, next);
+        trace_emit(&sim->trace, TRACE_SLEEP, sim->current_time, index, next);
+    }
+}
+
+static void schedule_next_process(Sim *sim, int cpu) {
+    CpuState *c = &sim->cpus[cpu];
+    int next;
+
+    sim->current_cpu = cpu;
+    next = sim->policy->pick_next(sim);
+    if (next == -1 && sim->num_cpus > 1) {
+        next = steal_task(sim, cpu);  // 자기 큐가 비었으면 가장 긴 큐에서 가져옴
+    }
+
+    if (next != -1) {
+        // 응답 시간: 첫 실행까지, I/O에서 깨어난 뒤 다시 실행될 때까지
+        PCBCold *cold = &sim->pcb_cold[next];
+        if (cold->first_run == -1) {
+            cold->first_run = sim->current_time;
+        }
+        if (cold->io_woken) {
+            cold->io_woken = 0;
+            sim->io_response_total += sim->current_time - sim->pcb_ready_since[next];
+            sim->io_responses++;
+        }
+        leave_ready(sim, next);
+        c->nr_ready--;
+        c->current = next;
+        c->dispatches++;
+        sim->dispatches++;
+
+        // 다른 CPU에서 실행하던 프로세스면 캐시 워밍업 페널티
+        if (sim->pcb_last_cpu[next] != -1 && sim->pcb_last_cpu[next] != cpu) {
+            sim->pcb_penalty[next] = sim->config.migration_penalty;
+            c->migrations++;
+        }
+        sim->pcb_last_cpu[next] = cpu;
+
+        set_state(sim, next, RUNNING);
+        trace_emit(&sim->trace, TRACE_DISPATCH, sim->current_time, next, sim->pcb_cpu_burst[next]);
+        if (sim->num_cpus > 1) {
+            log_emit(&sim->log, LOG_DETAIL, EVENT_DISPATCH_CPU, sim->current_time, cpu, next,
+                     sim->pcb_cpu_burst[next], sim->pcb_penalty[next] > 0);
+        } else if (sim->policy->uses_quantum) {
+            log_emit(&sim->log, LOG_DETAIL, EVENT_DISPATCH_QUANTUM, sim->current_time, next,
+                     sim->pcb_cpu_burst[next], sim->pcb_remaining_quantum[next], 0);
+        } else {
+            log_emit(&sim->log, LOG_DETAIL, EVENT_DISPATCH, sim->current_time, next, sim->pcb_cpu_burst[next], 0, 0);
+        }
+    } else {
+        c->current = -1;
+    }
+}
+
+// from CPU 준비 큐의 프로세스 하나를 to CPU 준비 큐로 옮김 (READY 상태와 대기 시간은 그대로)
+static int migrate(Sim *sim, int from, int to) {
+    int index = sim->policy->steal(sim, from);
+
+    if (index == -1) {
+        return -1;
+    }
+    sim->cpus[from].nr_ready--;
+    sim->pcb_cpu[index] = to;
+    sim->cpus[to].nr_ready++;
+    sim->policy->enqueue(sim, index);
+    return index;
+}
+
+// 작업 훔치기: 유휴 CPU가 가장 긴 준비 큐에서 하나를 가져와 바로 실행
+static int steal_task(Sim *sim, int thief) {
+    int victim = -1;
+
+    for (int cpu = 0; cpu < sim->num_cpus; cpu++) {
+        if (sim->cpus[cpu].nr_ready > 0 && (victim == -1 || sim->cpus[cpu].nr_ready > sim->cpus[victim].nr_ready)) {
+            victim = cpu;
+        }
+    }
+    if (victim == -1 || migrate(sim, victim, thief) == -1) {
+        return -1;
+    }
+    sim->cpus[thief].steals++;
+    sim->current_cpu = thief;
+    return sim->policy->pick_next(sim);
+}
+
+// 주기적 부하 균형: 부하(준비 큐 + 실행 중)가 가장 큰 CPU와 가장 작은 CPU의 차이가 1 이하가 될 때까지 옮김
+static void balance_load(Sim *sim) {
+    for (int moves = 0; moves < sim->num_processes; moves++) {
+        int busiest = -1, idlest = -1;
+        int busiest_load = 0, idlest_load = 0;
+
+        for (int cpu = 0; cpu < sim->num_cpus; cpu++) {
+            int load = sim->cpus[cpu].nr_ready + (sim->cpus[cpu].current != -1);
+            if (sim->cpus[cpu].nr_ready > 0 && (busiest == -1 || load > busiest_load)) {
+                busiest = cpu;
+                busiest_load = load;
+            }
+            if (idlest == -1 || load < idlest_load) {
+                idlest = cpu;
+                idlest_load = load;
+            }
+        }
+        if (busiest == -1 || busiest_load - idlest_load <= 1 || migrate(sim, busiest, idlest) == -1) {
+            break;
+        }
+        sim->balance_moves++;
+    }
+}
+
+// READY 진입: 진입 시간 기록 후 정책의 준비 큐에 추가
+static void make_ready(Sim *sim, int index) {
+    set_state(sim, index, READY);
+    sim->pcb_ready_since[index] = sim->current_time;
+    sim->cpus[sim->pcb_cpu[index]].nr_ready++;
+    sim->policy->enqueue(sim, index);
+}
+
+// READY 종료 (디스패치): 대기 시간 정산 (정책 큐에서는 pick_next가 이미 꺼냄)
+static void leave_ready(Sim *sim, int index) {
+    sim->pcb_cold[index].wait_time += sim->current_time - sim->pcb_ready_since[index];
+    sim->pcb_ready_since[index] = -1;
+}
+
+// 현재까지의 대기 시간 (READY 중이면 진행 중인 구간 포함)
+int sim_wait_time(Sim *sim, int index) {
+    int wait = sim->pcb_cold[index].wait_time;
+    if (sim->pcb_ready_since[index] != -1) {
+        wait += sim->current_time - sim->pcb_ready_since[index];
+    }
+    return wait;
+}
+
+static int gantt_state_code(enum State state) {
+    switch (state) {
+        case READY:   return 1;
+        case RUNNING: return 2;
+        case SLEEP:   return 3;
+        default:      return 0;
+    }
+}
+
+// 상태 변경 (간트 로그에 기록할 프로세스로 표시)
+// 실제 실행 모드: RUNNING이 되면 자식을 이어서 실행하고, RUNNING에서 READY/SLEEP으로 나가면 정지
+// (종료는 terminate_child가 처리)
+static void set_state(Sim *sim, int index, enum State state) {
+    if (sim->config.real_exec) {
+        enum State old = sim->pcb_state[index];
+        if (state == RUNNING && old != RUNNING) {
+            signal_child(sim, index, SIGCONT);
+        } else if (old == RUNNING && (state == READY || state == SLEEP)) {
+            signal_child(sim, index, SIGSTOP);
+        }
+    }
+    sim->pcb_state[index] = state;
+    if (!sim->gantt_marked[index]) {
+        sim->gantt_marked[index] = 1;
+        sim->gantt_dirty[sim->gantt_dirty_count++] = index;
+    }
+}
+
+// 상태가 바뀐 프로세스만 time 틱부터의 상태를 간트 로그에 기록
+// 이번 틱에 실행한 프로세스(CPU별 executed)는 RUNNING, 틱 끝에 막 디스패치된 프로세스는 아직 실행 전이므로
+// READY로 기록하고 다음 기록 때 RUNNING으로 다시 기록 (한 틱에 RUNNING은 CPU마다 하나)
+static void record_gantt(Sim *sim, int time) {
+    int kept = 0;
+
+    if (time > sim->gantt_until) {
+        // 출력 창이 지났으면 기록하지 않음 (열린 시스템: 로그가 실행 시간에 따라 늘지 않게)
+        for (int k = 0; k < sim->gantt_dirty_count; k++) {
+            sim->gantt_marked[sim->gantt_dirty[k]] = 0;
+        }
+        sim->gantt_dirty_count = 0;
+        for (int cpu = 0; cpu < sim->num_cpus; cpu++) {
+            trace_emit(&sim->trace, TRACE_TICK, time, sim->cpus[cpu].executed, cpu);
+        }
+        return;
+    }
+
+    for (int k = 0; k < sim->gantt_dirty_count; k++) {
+        int p = sim->gantt_dirty[k];
+        int code = gantt_state_code(sim->pcb_state[p]);
+        if (code == 2 && sim->cpus[sim->pcb_cpu[p]].executed != p) {
+            gl_record(&sim->gantt_logs[p], time, 1);
+            sim->gantt_dirty[kept++] = p;
+            continue;
+        }
+        sim->gantt_marked[p] = 0;
+        gl_record(&sim->gantt_logs[p], time, code);
+    }
+    sim->gantt_dirty_count = kept;
+
+    for (int cpu = 0; cpu < sim->num_cpus; cpu++) {
+        int executed = sim->cpus[cpu].executed;
+        if (sim->num_cpus > 1) {
+            gl_record(&sim->cpus[cpu].log, time, executed + 1);
+        }
+        if (executed != -1) {
+            // 이번 틱에 실행하고 나간 프로세스도 RUNNING으로 기록, 다음 틱에 실제 상태로 다시 기록
+            gl_record(&sim->gantt_logs[executed], time, 2);
+            if (!sim->gantt_marked[executed]) {
+                sim->gantt_marked[executed] = 1;
+                sim->gantt_dirty[sim->gantt_dirty_count++] = executed;
+            }
+        }
+        trace_emit(&sim->trace, TRACE_TICK, time, executed, cpu);
+    }
+}
+
+static void print_separator(Sim *sim, int time) {
+    // 10초마다 구분선 출력
+    if (time % 10 == 0) {
+        log_emit(&sim->log, LOG_LIFECYCLE, EVENT_SEPARATOR, time, 0, 0, 0, 0);
+    }
+}
+
+// 이벤트 로그 레코드를 한 줄로 출력 (log_drain이 메인 루프에서 호출)
+static void format_event(const LogRecord *rec) {
+    const int32_t *a = rec->arg;
+
+    switch (rec->type) {
+        case EVENT_ARRIVAL_JOB:
+            printf("[시간:%d][프로세스 %d] 도착 (CPU 버스트 %d, 우선순위 %d, 버스트 %d개)\n",
+                   rec->time, a[0], a[1], a[2], a[3]);
+            break;
+        case EVENT_ARRIVAL:
+            printf("[시간:%d][프로세스 %d] 도착 (CPU 버스트 %d, 우선순위 %d)\n", rec->time, a[0], a[1], a[2]);
+            break;
+        case EVENT_DISPATCH_CPU:
+            printf("[시간:%d][CPU %d][프로세스 %d] 스케줄링 (남은 버스트: %d%s)\n",
+                   rec->time, a[0], a[1], a[2], a[3] ? ", 이주" : "");
+            break;
+        case EVENT_DISPATCH_QUANTUM:
+            printf("[시간:%d][프로세스 %d] 스케줄링 (남은 버스트: %d, 남은 퀀텀: %d)\n", rec->time, a[0], a[1], a[2]);
+            break;
+        case EVENT_DISPATCH:
+            printf("[시간:%d][프로세스 %d] 스케줄링 (남은 버스트: %d)\n", rec->time, a[0], a[1]);
+            break;
+        case EVENT_QUANTUM:
+            printf("[시간:%d][프로세스 %d] 타임 퀀텀 만료\n", rec->time, a[0]);
+            break;
+        case EVENT_QUANTUM_RESET:
+            printf("[시간:%d] 모든 프로세스 타임퀀텀 소진 → 전체 타임퀀텀 초기화\n", rec->time);
+            break;
+        case EVENT_IO_REQUEST:
+            printf("[시간:%d][프로세스 %d] CPU 버스트 완료, I/O 요청 (대기: %d)\n", rec->time, a[0], a[1]);
+            break;
+        case EVENT_IO_DONE:
+            printf("[시간:%d][프로세스 %d] I/O 완료, READY로 이동\n", rec->time, a[0]);
+            break;
+        case EVENT_EXIT:
+            printf("[시간:%d][프로세스 %d] 종료됨. 완료: %d/%d\n", rec->time, a[0], a[1], a[2]);
+            break;
+        case EVENT_EXIT_OPEN:
+            printf("[시간:%d][프로세스 %d] 종료됨. 완료: %d (실행 중 %d)\n", rec->time, a[0], a[1], a[2]);
+            break;
+        case EVENT_JOB_DONE:
+            printf("[시간:%d][태스크 %d] 작업 완료 (데드라인 %d, %s %d)\n", rec->time, a[0], a[1],
+                   a[2] > 0 ? "미스! 지연" : "여유", a[2] > 0 ? a[2] : -a[2]);
+            break;
+        case EVENT_AGING_TOP:
+            printf("[에이징] P%d: 초기 %d → 현재 0 ★ 최고 우선순위 도달!\n", a[0], a[1]);
+            break;
+        case EVENT_MLFQ_DEMOTE:
+            printf("[MLFQ] P%d: 레벨 %d 허용량 %d틱 소진 → 레벨 %d\n", a[0], a[1], a[2], a[3]);
+            break;
+        case EVENT_MLFQ_BOOST:
+            printf("[MLFQ] 시간 %d: 우선순위 부스트 (모든 프로세스 → 레벨 0)\n", rec->time);
+            break;
+        case EVENT_SEPARATOR:
+            printf("────────────────────────────── [%d초] ──────────────────────────────\n", rec->time);
+            break;
+    }
+}
+
+// 모든 CPU 준비 큐에 있는 프로세스 수
+static int ready_count(Sim *sim) {
+    int ready = 0;
+
+    for (int cpu = 0; cpu < sim->num_cpus; cpu++) {
+        ready += sim->cpus[cpu].nr_ready;
+    }
+    return ready;
+}
+
+// 준비 큐 길이가 ticks 틱 동안 그대로였음 (시간 평균 큐 길이용)
+static void accumulate_ready(Sim *sim, int ticks) {
+    long long area = (long long)ready_count(sim) * ticks;
+
+    sim->interval.ready_area += area;
+    sim->ready_area += area;
+}
+
+static long long total_busy_ticks(Sim *sim) {
+    long long busy = 0;
+
+    for (int cpu = 0; cpu < sim->num_cpus; cpu++) {
+        busy += sim->cpus[cpu].busy_ticks;
+    }
+    return busy;
+}
+
+static void print_interval_header(Sim *sim) {
+    printf("\n=== 구간 보고 (%s, %d틱마다) ===\n", sim->policy->title, sim->config.report_interval);
+    printf("구간 (틱)              도착     완료   실행 중   평균 준비 큐   사용률   평균 턴어라운드   최대 턴어라운드\n");
+}
+
+// 지난 보고 이후 구간의 도착/완료, 구간 끝의 실행 중 프로세스 수, 시간 평균 준비 큐 길이,
+// CPU 사용률, 구간에 끝난 프로세스의 턴어라운드를 출력하고 다음 구간 시작
+static void print_interval(Sim *sim) {
+    IntervalStats *iv = &sim->interval;
+    int ticks = sim->current_time - iv->start;
+    long long busy = total_busy_ticks(sim);
+
+    log_drain(&sim->log);   // 이 보고 전에 쌓인 이벤트를 먼저 (가상 시간 모드 전용이라 틱 안에서 출력해도 됨)
+    printf("%9d-%-10d %8lld %8lld %9d %14.2f %7.1f%% %17.2f %17d\n", iv->start + 1, sim->current_time,
+           iv->arrivals, iv->completions, sim->live, ticks > 0 ? (double)iv->ready_area / ticks : 0.0,
+           ticks > 0 ? 100.0 * (busy - iv->busy_ticks) / ((long long)ticks * sim->num_cpus) : 0.0,
+           iv->completions > 0 ? (double)iv->turnaround / iv->completions : 0.0, iv->max_turnaround);
+
+    memset(iv, 0, sizeof(IntervalStats));
+    iv->start = sim->current_time;
+    iv->busy_ticks = busy;
+}
+
+// 다음 이벤트(퀀텀 만료, 버스트 완료, I/O 완료, 작업 도착, 구간 보고, 정책 자체 이벤트)까지 남은 틱 수 (없으면 -1)
+static int ticks_until_next_event(Sim *sim) {
+    int next = tw_next_expiry(&sim->io_wheel, sim->current_time);  // I/O 완료
+    int arrival = next_arrival(sim);
+
+    if (arrival != -1) {
+        int ticks = arrival - sim->current_time;                  // 다음 작업 도착
+        if (next == -1 || ticks < next) {
+            next = ticks;
+        }
+    }
+    if (sim->open && sim->config.report_interval > 0) {
+        int ticks = sim->config.report_interval - sim->current_time % sim->config.report_interval;
+        if (next == -1 || ticks < next) {
+            next = ticks;
+        }
+    }
+
+    if (sim->policy->next_event != NULL) {
+        int ticks = sim->policy->next_event(sim);
+        if (ticks != -1 && (next == -1 || ticks < next)) {
+            next = ticks;
+        }
+    }
+
+    // 다중 CPU: 부하 균형 틱, 유휴 CPU가 있는데 준비 큐에 프로세스가 남아 있으면 다음 틱에 훔치기
+    if (sim->num_cpus > 1) {
+        int ticks = BALANCE_INTERVAL - sim->current_time % BALANCE_INTERVAL;
+        int idle = 0, ready = 0;
+        if (next == -1 || ticks < next) {
+            next = ticks;
+        }
+        for (int cpu = 0; cpu < sim->num_cpus; cpu++) {
+            idle |= sim->cpus[cpu].current == -1;
+            ready |= sim->cpus[cpu].nr_ready > 0;
+        }
+        if (idle && ready) {
+            return 1;
+        }
+    }
+
+    // CPU별 실행 중인 프로세스 (이주 페널티 + 버스트 완료/퀀텀 만료)
+    for (int cpu = 0; cpu < sim->num_cpus; cpu++) {
+        int p = sim->cpus[cpu].current;
+        if (p != -1 && sim->pcb_state[p] == RUNNING) {
+            int ticks = sim->pcb_penalty[p] + sim->pcb_cpu_burst[p];
+            if (sim->policy->uses_quantum && sim->pcb_remaining_quantum[p] < ticks) {
+                ticks = sim->pcb_remaining_quantum[p];
+            }
+            if (next == -1 || ticks < next) {
+                next = ticks;
+            }
+        }
+    }
+
+    return next;
+}
+
+// 이벤트가 없는 틱들을 한 번에 진행 (틱 단위 실행과 같은 상태가 되도록 누적)
+static void skip_quiet_ticks(Sim *sim, int ticks) {
+    int start = sim->current_time + 1;
+    int end = sim->current_time + ticks;
+
+    for (int cpu = 0; cpu < sim->num_cpus; cpu++) {
+        int p = sim->cpus[cpu].current;
+        sim->cpus[cpu].executed = p != -1 && sim->pcb_state[p] == RUNNING ? p : -1;
+    }
+
+    // 건너뛰는 동안 상태가 바뀌지 않으므로 시작 틱에 한 번만 기록
+    // (READY 대기 시간은 ready_since로 계산하므로 실행 중인 프로세스만 누적)
+    record_gantt(sim, start);
+    for (int cpu = 0; cpu < sim->num_cpus; cpu++) {
+        CpuState *c = &sim->cpus[cpu];
+        int p = c->executed;
+        if (p == -1) {
+            continue;
+        }
+        int penalty = sim->pcb_penalty[p] < ticks ? sim->pcb_penalty[p] : ticks;
+        sim->pcb_penalty[p] -= penalty;
+        c->penalty_ticks += penalty;
+        c->busy_ticks += ticks;
+        sim->pcb_cpu_burst[p] -= ticks - penalty;
+        sim->pcb_run_ticks[p] += ticks - penalty;
+        if (sim->policy->uses_quantum) {
+            sim->pcb_remaining_quantum[p] -= ticks;
+        }
+    }
+
+    // 건너뛴 구간의 구분선도 동일하게 출력
+    for (int t = (start + 9) / 10 * 10; t <= end; t += 10) {
+        print_separator(sim, t);
+    }
+    // 보고 틱은 이벤트로 잡혀 있으므로 건너뛰는 구간 안에 없음
+    if (sim->open) {
+        accumulate_ready(sim, ticks);
+    }
+
+    sim->current_time = end;
+}
+
+static void run_virtual_time(Sim *sim) {
+    struct timespec begin, end;
+    clock_gettime(CLOCK_MONOTONIC, &begin);
+
+    while (sim->live > 0 || next_arrival(sim) != -1) {
+        int delta = ticks_until_next_event(sim);
+        if (delta == -1) {
+            break;  // 진행할 이벤트 없음
+        }
+        if (delta > 1) {
+            skip_quiet_ticks(sim, delta - 1);
+        }
+        sim_tick(sim);
+        trace_drain(&sim->trace);
+        log_drain(&sim->log);
+    }
+    if (sim->open && sim->config.report_interval > 0 && sim->current_time > sim->interval.start) {
+        print_interval(sim);    // 마지막 보고 이후 남은 구간
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    if (sim->config.verbose) {
+        double elapsed = (end.tv_sec - begin.tv_sec) + (end.tv_nsec - begin.tv_nsec) / 1e9;
+        printf("\n[가상 시간] %d틱 시뮬레이션: %.3f ms (%.0f 틱/초)\n",
+               sim->current_time, elapsed * 1e3, elapsed > 0 ? sim->current_time / elapsed : 0.0);
+    }
+}
+
+void sim_print_gantt_chart(Sim *sim) {
+    printf("\n=== 간트 차트 (%s) ===\n\n", sim->policy->title);
+
+    int from = sim->config.gantt_from;
+    int to = sim->config.gantt_to != -1 ? sim->config.gantt_to : from + GANTT_WIDTH - 1;
+    if (to > sim->current_time) to = sim->current_time;
+
+    // 시간 헤더
+    printf("시간: ");
+    for (int t = from - 1; t <= to; t += 10) {
+        printf("%-10d", t);
+    }
+    printf("\n");
+
+    // 눈금자
+    printf("      ");
+    for (int t = from; t <= to; t++) {
+        if (t % 10 == 0) {
+            printf("|");
+        } else if (t % 5 == 0) {
+            printf("+");
+        } else {
+            printf("-");
+        }
+    }
+    printf("\n");
+
+    // 각 프로세스별 타임라인 (구간 로그에서 시간 창만 조회)
+    int *codes = malloc(sizeof(int) * (to >= from ? to - from + 1 : 1));
+    for (int p = 0; p < sim->num_processes && p < MAX_PRINT_PROCESSES; p++) {
+        printf(sim->open ? "S%-4d " : "P%-4d ", p);
+        gl_query(&sim->gantt_logs[p], from, to, codes);
+        for (int t = from; t <= to; t++) {
+            switch (codes[t - from]) {
+                case 1:  printf("·"); break;  // READY
+                case 2:  printf("█"); break;  // RUNNING
+                case 3:  printf("░"); break;  // SLEEP
+                default: printf(" "); break;  // DONE 또는 시작 전
+            }
+        }
+        printf("\n");
+    }
+    if (sim->num_processes > MAX_PRINT_PROCESSES) {
+        printf("... (외 %d개 프로세스 생략)\n", sim->num_processes - MAX_PRINT_PROCESSES);
+    }
+
+    // 다중 CPU: CPU별로 실행한 프로세스 (번호 끝자리, 유휴 = 공백)
+    if (sim->num_cpus > 1) {
+        printf("\n");
+        for (int cpu = 0; cpu < sim->num_cpus && cpu < MAX_PRINT_PROCESSES; cpu++) {
+            printf("CPU%-3d", cpu);
+            gl_query(&sim->cpus[cpu].log, from, to, codes);
+            for (int t = from; t <= to; t++) {
+                printf("%c", codes[t - from] > 0 ? '0' + (codes[t - from] - 1) % 10 : ' ');
+            }
+            printf("\n");
+        }
+        if (sim->num_cpus > MAX_PRINT_PROCESSES) {
+            printf("... (외 %d개 CPU 생략)\n", sim->num_cpus - MAX_PRINT_PROCESSES);
+        }
+    }
+    free(codes);
+
+    // 범례
+    printf("\n범례:  █ = RUNNING   ░ = SLEEP   · = READY%s\n",
+           sim->num_cpus > 1 ? "   CPU 행 = 실행한 프로세스 번호 끝자리" : "");
+    if (sim->open) {
+        printf("       S = PCB 슬롯 (끝난 프로세스의 슬롯을 새로 도착한 프로세스가 재사용)\n");
+    }
+}
+
+// 평균은 종료할 때 누적한 값으로 계산 (열린 시스템에서는 PCB 슬롯이 재사용되므로)
+void sim_summarize(Sim *sim, SimResult *result) {
+    int process_count = sim->completed_processes;
+
+    result->total_time = sim->current_time;
+    result->completed = process_count;
+    result->dispatches = sim->dispatches;
+    result->avg_wait_time = process_count > 0 ? (double)sim->total_wait / process_count : 0.0;
+    result->avg_turnaround = process_count > 0 ? (double)sim->total_turnaround / process_count : 0.0;
+    result->avg_response = process_count > 0 ? (double)sim->total_response / process_count : 0.0;
+    result->avg_io_response = sim->io_responses > 0 ? (double)sim->io_response_total / sim->io_responses : 0.0;
+    result->jobs = sim->lateness_count;
+    result->deadline_misses = 0;
+    for (int k = 0; k < sim->lateness_count; k++) {
+        result->deadline_misses += sim->lateness[k] > 0;
+    }
+}
+
+void sim_print_statistics(Sim *sim) {
+    printf("\n=== 최종 통계 (%s) ===\n", sim->policy->title);
+    if (sim->policy->uses_quantum) {
+        printf("사용된 타임 퀀텀: %d\n", sim->config.time_quantum);
+    }
+    printf("총 시뮬레이션 시간: %d\n", sim->current_time);
+
+    // 프로세스별 통계는 닫힌 시스템만 (열린 시스템의 PCB에는 슬롯을 마지막으로 쓴 프로세스만 남음)
+    for (int i = 0; !sim->open && i < sim->num_processes && i < MAX_PRINT_PROCESSES; i++) {
+        if (sim->pcb_cold[i].completion_time != -1) {
+            printf("프로세스 %d - 대기 시간: %d, 턴어라운드: %d\n",
+                   i, sim->pcb_cold[i].wait_time,
+                   sim->pcb_cold[i].completion_time - sim->pcb_cold[i].start_time);
+        }
+    }
+    if (!sim->open && sim->num_processes > MAX_PRINT_PROCESSES) {
+        printf("... (외 %d개 프로세스 생략)\n", sim->num_processes - MAX_PRINT_PROCESSES);
+    }
+
+    if (sim->policy->print_stats != NULL) {
+        sim->policy->print_stats(sim);
+    }
+    if (sim->lateness != NULL) {
+        print_deadline_statistics(sim);
+    }
+    if (sim->num_cpus > 1) {
+        print_cpu_statistics(sim);
+    }
+    if (sim->config.real_exec) {
+        print_exec_statistics(sim);
+    }
+    if (!sim->config.virtual_mode) {
+        print_latency_statistics(sim);
+    }
+    if (sim->config.job_path != NULL) {
+        printf("\n작업 트레이스: %lld개 재생 (건너뜀 %lld줄, 도착 순서 보정 %lld개)\n",
+               sim->jobs.jobs, sim->jobs.skipped, sim->jobs.reordered);
+    }
+    if (sim->open) {
+        int time = sim->current_time > 0 ? sim->current_time : 1;
+        printf("%s열린 시스템: 도착 %lld개, 완료 %d개, 처리율 %.4f개/틱, CPU 사용률 %.1f%%, 평균 준비 큐 %.2f\n",
+               sim->config.job_path != NULL ? "" : "\n", sim->arrivals, sim->completed_processes,
+               (double)sim->completed_processes / time,
+               100.0 * total_busy_ticks(sim) / ((long long)time * sim->num_cpus), (double)sim->ready_area / time);
+        printf("PCB 슬롯: %d개 (동시 최대 %d개 실행 중)\n", sim->num_processes, sim->peak_live);
+    }
+
+    SimResult result;
+    sim_summarize(sim, &result);
+    if (result.completed > 0) {
+        printf("\n평균 대기 시간: %.2f time units\n", result.avg_wait_time);
+        printf("평균 턴어라운드 시간: %.2f time units\n", result.avg_turnaround);
+        printf("평균 응답 시간: %.2f time units (첫 실행까지)\n", result.avg_response);
+        printf("평균 I/O 복귀 응답 시간: %.2f time units (%lld회)\n", result.avg_io_response, sim->io_responses);
+    }
+    printf("=================\n");
+}
+
+// 프로세서 수요 검사 (EDF, 단일 CPU): 모든 절대 데드라인 t ≤ L에서 dbf(t) ≤ t 이면 스케줄 가능
+// dbf(t) = 데드라인이 t 이하인 작업들의 WCET 합이므로 (데드라인, WCET) 점을 정렬해 누적 합으로 검사
+// L = 동기 릴리스 바쁜 구간 길이 (U ≤ 1이면 유한), 검사 점이 너무 많으면 -1 (판정 생략)
+#define DEMAND_MAX_POINTS 4000000
+
+typedef struct {
+    long long time;
+    int wcet;
+} DemandPoint;
+
+static int compare_demand(const void *a, const void *b) {
+    long long ta = ((const DemandPoint *)a)->time, tb = ((const DemandPoint *)b)->time;
+    return (ta > tb) - (ta < tb);
+}
+
+static int edf_demand_test(Sim *sim, double utilization) {
+    int n = sim->num_processes;
+    long long busy = 0, points = 0;
+
+    if (utilization > 1.0 + 1e-9) {
+        return 0;
+    }
+    // 바쁜 구간: w = Σ ceil(w / P) × C 가 고정점에 도달할 때까지
+    for (int i = 0; i < n; i++) {
+        busy += sim->pcb_cold[i].wcet;
+    }
+    for (int iter = 0; iter < 100000; iter++) {
+        long long next = 0;
+        for (int i = 0; i < n; i++) {
+            next += (busy + sim->pcb_cold[i].period - 1) / sim->pcb_cold[i].period * sim->pcb_cold[i].wcet;
+        }
+        if (next == busy) {
+            break;
+        }
+        busy = next;
+    }
+    for (int i = 0; i < n; i++) {
+        if (sim->pcb_cold[i].rel_deadline <= busy) {
+            points += (busy - sim->pcb_cold[i].rel_deadline) / sim->pcb_cold[i].period + 1;
+        }
+    }
+    if (points > DEMAND_MAX_POINTS) {
+        return -1;
+    }
+
+    DemandPoint *demand = malloc(sizeof(DemandPoint) * (points > 0 ? points : 1));
+    long long count = 0;
+    for (int i = 0; i < n; i++) {
+        for (long long t = sim->pcb_cold[i].rel_deadline; t <= busy; t += sim->pcb_cold[i].period) {
+            demand[count].time = t;
+            demand[count].wcet = sim->pcb_cold[i].wcet;
+            count++;
+        }
+    }
+    qsort(demand, count, sizeof(DemandPoint), compare_demand);
+
+    int schedulable = 1;
+    long long total = 0;
+    for (long long k = 0; k < count && schedulable; k++) {
+        total += demand[k].wcet;
+        if ((k + 1 == count || demand[k + 1].time != demand[k].time) && total > demand[k].time) {
+            schedulable = 0;
+        }
+    }
+    free(demand);
+    return schedulable;
+}
+
+static int compare_int(const void *a, const void *b) {
+    int ia = *(const int *)a, ib = *(const int *)b;
+    return (ia > ib) - (ia < ib);
+}
+
+// 데드라인 미스, 지연 백분위, 스케줄 가능성 (평균 턴어라운드에 가려지는 꼬리 지연 확인용)
+static void print_deadline_statistics(Sim *sim) {
+    double utilization = 0, density = 0;
+    int misses = 0;
+
+    for (int i = 0; i < sim->num_processes; i++) {
+        const PCBCold *cold = &sim->pcb_cold[i];
+        int window = cold->rel_deadline < cold->period ? cold->rel_deadline : cold->period;
+        utilization += (double)cold->wcet / cold->period;
+        density += (double)cold->wcet / window;
+    }
+    int demand = edf_demand_test(sim, utilization);
+
+    printf("\n=== 데드라인 (실시간 태스크) ===\n");
+    printf("사용률 U = %.3f, 밀도 = %.3f\n", utilization, density);
+    printf("EDF 스케줄 가능성 (프로세서 수요 검사): %s\n",
+           demand == 1 ? "가능" : demand == 0 ? "불가능" : "판정 생략 (검사 점이 너무 많음)");
+
+    for (int i = 0; i < sim->num_processes && i < MAX_PRINT_PROCESSES; i++) {
+        const PCBCold *cold = &sim->pcb_cold[i];
+        printf("태스크 %d - 주기 %d, WCET %d, 데드라인 %d%s: 작업 %d, 미스 %d, 최대 지연 %d\n",
+               i, cold->period, cold->wcet, cold->rel_deadline, cold->sporadic ? " (산발적)" : "",
+               cold->jobs, cold->misses, cold->max_lateness);
+    }
+    if (sim->num_processes > MAX_PRINT_PROCESSES) {
+        printf("... (외 %d개 태스크 생략)\n", sim->num_processes - MAX_PRINT_PROCESSES);
+    }
+
+    int count = sim->lateness_count;
+    if (count == 0) {
+        return;
+    }
+    int *sorted = malloc(sizeof(int) * count);
+    memcpy(sorted, sim->lateness, sizeof(int) * count);
+    qsort(sorted, count, sizeof(int), compare_int);
+    for (int k = 0; k < count; k++) {
+        misses += sorted[k] > 0;
+    }
+    printf("작업 %d개, 데드라인 미스 %d개 (%.2f%%)\n", count, misses, 100.0 * misses / count);
+    printf("지연 (완료 - 데드라인) 백분위: p50 %d, p90 %d, p99 %d, 최대 %d\n",
+           sorted[(count - 1) * 50 / 100], sorted[(count - 1) * 90 / 100],
+           sorted[(count - 1) * 99 / 100], sorted[count - 1]);
+    free(sorted);
+}
+
+// CPU별 사용률, 디스패치, 이주와 훔치기 (부하가 고르게 퍼졌는지, 이주 비용이 얼마인지)
+static void print_cpu_statistics(Sim *sim) {
+    long long migrations = 0, steals = 0, penalty = 0;
+
+    printf("\n=== CPU별 통계 (CPU %d개, 이주 페널티 %d틱, 부하 균형 %d틱마다) ===\n",
+           sim->num_cpus, sim->config.migration_penalty, BALANCE_INTERVAL);
+    printf("CPU    사용률   디스패치     이주   훔치기   페널티 틱\n");
+    for (int cpu = 0; cpu < sim->num_cpus; cpu++) {
+        const CpuState *c = &sim->cpus[cpu];
+        if (cpu < MAX_PRINT_PROCESSES) {
+            printf("%-4d %7.1f%% %10lld %8lld %8lld %11lld\n", cpu,
+                   sim->current_time > 0 ? 100.0 * c->busy_ticks / sim->current_time : 0.0,
+                   c->dispatches, c->migrations, c->steals, c->penalty_ticks);
+        }
+        migrations += c->migrations;
+        steals += c->steals;
+        penalty += c->penalty_ticks;
+    }
+    if (sim->num_cpus > MAX_PRINT_PROCESSES) {
+        printf("... (외 %d개 CPU 생략)\n", sim->num_cpus - MAX_PRINT_PROCESSES);
+    }
+    printf("합계: 이주 %lld회 (훔치기 %lld, 부하 균형 %lld), 페널티 %lld틱\n",
+           migrations, steals, sim->balance_moves, penalty);
+}
+
+// 스케줄러가 준 틱과 자식이 실제로 쓴 CPU 시간 비교, 스케줄러 자신의 비용
+// 실제/배정이 1보다 작으면 틱 동안 다른 프로세스에게 CPU를 빼앗긴 것이고, 크면 정지 시그널이 늦게 도착한 것
+static void print_exec_statistics(Sim *sim) {
+    double tick_ms = sim->config.tick_us / 1000.0;
+    long long granted = 0, used = 0, dispatches = 0, ticks = sim->latency.tick_work.total;
+    long voluntary = 0, involuntary = 0;
+
+    printf("\n=== 실제 실행 (틱 %.1fms) ===\n", tick_ms);
+    printf("프로세스   배정 틱   배정(ms)   실제(ms)   실제/배정   자발적 교환   비자발적 교환\n");
+    for (int i = 0; i < sim->num_processes; i++) {
+        const PCBCold *cold = &sim->pcb_cold[i];
+        double granted_ms = cold->granted_ticks * tick_ms;
+        double used_ms = cold->cpu_us / 1000.0;
+
+        if (cold->cpu_us < 0) {
+            continue;   // 회수하지 못함
+        }
+        if (i < MAX_PRINT_PROCESSES) {
+            printf("P%-8d %8d %10.1f %10.1f %11.3f %13ld %15ld\n", i, cold->granted_ticks, granted_ms, used_ms,
+                   granted_ms > 0 ? used_ms / granted_ms : 0.0, cold->voluntary_switches, cold->involuntary_switches);
+        }
+        granted += cold->granted_ticks;
+        used += cold->cpu_us;
+        voluntary += cold->voluntary_switches;
+        involuntary += cold->involuntary_switches;
+    }
+    if (sim->num_processes > MAX_PRINT_PROCESSES) {
+        printf("... (외 %d개 프로세스 생략)\n", sim->num_processes - MAX_PRINT_PROCESSES);
+    }
+    for (int cpu = 0; cpu < sim->num_cpus; cpu++) {
+        dispatches += sim->cpus[cpu].dispatches;
+    }
+
+    printf("합계: 배정 %.1fms, 실제 %.1fms (%.3f), 자발적 교환 %ld회, 비자발적 교환 %ld회\n",
+           granted * tick_ms, used / 1000.0, granted > 0 ? used / 1000.0 / (granted * tick_ms) : 0.0,
+           voluntary, involuntary);
+    printf("스케줄러 CPU: %.1fms (틱당 %.1fus, 디스패치당 %.1fus), STOP/CONT 시그널 %lld개\n",
+           sim->exec.parent_cpu_us / 1000.0,
+           ticks > 0 ? (double)sim->exec.parent_cpu_us / ticks : 0.0,
+           dispatches > 0 ? (double)sim->exec.parent_cpu_us / dispatches : 0.0, sim->exec.signals);
+}
+
+// 제어 경로의 꼬리 지연 (실시간 틱 모드)
+static void print_latency_statistics(Sim *sim) {
+    printf("\n=== 제어 경로 지연 (us) ===\n");
+    printf("측정            표본       평균      최소       p50       p90       p99     p99.9       최대\n");
+    hist_print("명령 전달  ", &sim->latency.delivery);
+    hist_print("타이머 지터", &sim->latency.jitter);
+    hist_print("틱 처리    ", &sim->latency.tick_work);
+    if (sim->config.control == CONTROL_FUTEX) {
+        printf("제어: 공유 메모리 + futex (잠들기 전 확인 %d회), 명령 %lld개 중 FUTEX_WAKE %lld회\n",
+               sim->config.spin, sim->exec.commands, sim->exec.wakes);
+    } else {
+        printf("제어: 시그널, 명령 %lld개\n", sim->exec.commands);
+    }
+    printf("자식 생성 (%s): %d개, %.1fms (개당 %.1fus)\n",
+           sim->config.spawn == SPAWN_POSIX ? "posix_spawn" : "fork", sim->num_processes, sim->exec.spawn_ns / 1e6,
+           sim->num_processes > 0 ? sim->exec.spawn_ns / 1000.0 / sim->num_processes : 0.0);
+    printf("스케줄러 CPU: %.1fms (틱당 %.1fus)\n", sim->exec.parent_cpu_us / 1000.0,
+           sim->latency.tick_work.total > 0 ? (double)sim->exec.parent_cpu_us / sim->latency.tick_work.total : 0.0);
+    if (sim->config.latency_path != NULL) {
+        printf("히스토그램: %s\n", sim->config.latency_path);
+    }
+}
+
+void sim_free(Sim *sim) {
+    if (sim->policy->destroy != NULL) {
+        sim->policy->destroy(sim);
+    }
+    js_close(&sim->jobs);
+    log_close(&sim->log);
+    for (int i = 0; i < sim->num_processes; i++) {
+        free(sim->gantt_logs[i].runs);
+        free(sim->pcb_cold[i].script);
+    }
+    for (int cpu = 0; cpu < sim->num_cpus; cpu++) {
+        free(sim->cpus[cpu].log.runs);
+    }
+    free(sim->cpus);
+    free(sim->pid_index.keys);
+    free(sim->pid_index.values);
+    free(sim->arena.block);
+    free(sim->lateness);
+    if (sim->probes != NULL) {
+        munmap(sim->probes, sizeof(ChildProbe) * (sim->num_processes > 0 ? sim->num_processes : 1));
+    }
+}
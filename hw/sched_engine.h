@@ -0,0 +1,341 @@
+#ifndef SCHED_ENGINE_H
+#define SCHED_ENGINE_H
+
+#include <sys/types.h>
+#include <limits.h>
+
+#include "timer_wheel.h"
+#include "pid_table.h"
+#include "pcb_arena.h"
+#include "gantt_log.h"
+#include "sched_trace.h"
+#include "job_stream.h"
+#include "latency_hist.h"
+#include "event_log.h"
+
+// 스케줄링 엔진: PCB 저장소, 틱 처리, 가상/실시간 실행, 간트 차트, 통계를 공통으로 처리하고
+// 어떤 프로세스를 언제 실행할지는 정책(Policy) 플러그인이 결정
+#define MAX_PRINT_PROCESSES 50  // 생성 로그/간트 차트/프로세스별 통계는 앞의 50개까지만 출력
+#define MAX_TIME_QUANTUM 10
+#define MAX_PRIORITY 10         // 최저 우선순위 (숫자가 클수록 낮은 우선순위)
+#define MIN_PRIORITY 0          // 최고 우선순위
+#define GANTT_WIDTH 150         // 간트 차트 기본 출력 폭 (화면에 맞게)
+#define MAX_CPUS 256            // -c 옵션 상한
+#define DEFAULT_AGING_INTERVAL 10  // 우선순위 정책: READY로 이 틱만큼 기다릴 때마다 에이징
+#define DEFAULT_AGING_AMOUNT 1  // 에이징 시 우선순위 증가량 (숫자 감소)
+#define BALANCE_INTERVAL 10     // 다중 CPU: 이 틱 간격마다 준비 큐 길이를 맞춤
+#define JOB_INITIAL_CAPACITY 64 // 열린 시스템의 PCB 저장소 초기 용량 (빈 슬롯이 없을 때만 두 배씩 늘림)
+#define DEFAULT_REPORT_INTERVAL 1000  // 열린 시스템: 이 틱 간격마다 사용률/준비 큐/턴어라운드 보고
+
+// 프로세스 상태
+enum State {
+    READY,
+    RUNNING,
+    SLEEP,
+    DONE
+};
+
+// 콜드 필드 - 생성/종료/통계 때만 접근
+typedef struct {
+    pid_t pid;
+    int wait_time;          // READY 구간이 끝날 때 누적 (진행 중인 구간은 sim_wait_time으로 계산)
+    int start_time;
+    int completion_time;
+    int first_run;          // 첫 디스패치 시간 (-1 = 아직 실행 안 됨)
+    int io_woken;           // 1 = I/O 완료로 READY에 들어와 아직 디스패치 안 됨
+    int initial_priority;   // 작업 부하가 정한 우선순위 (우선순위 정책이 사용)
+
+    // 실시간 태스크 (period 0 = 일반 프로세스)
+    int period;             // 주기 (산발적 태스크는 최소 도착 간격)
+    int wcet;               // 최악 실행 시간
+    int rel_deadline;       // 상대 데드라인 (릴리스 기준)
+    int sporadic;           // 1 = 다음 릴리스가 주기 + 임의 지연
+    int release;            // 현재 작업의 릴리스 시간
+    int jobs;               // 완료한 작업 수
+    int misses;             // 데드라인을 넘겨 완료한 작업 수
+    int max_lateness;       // 최대 지연 (완료 - 데드라인, 음수 = 여유)
+
+    // 작업 트레이스 재생 (script NULL = 난수로 버스트/I/O/종료 결정)
+    int *script;            // CPU, I/O, CPU, ..., CPU (종료할 때 해제)
+    int script_len;
+    int script_pos;         // 다음에 쓸 I/O 시간의 위치
+
+    // 실제 실행 모드 (wait4로 회수할 때 채움)
+    int granted_ticks;      // 스케줄러가 실행시킨 틱 수
+    long long cpu_us;       // 자식이 실제로 쓴 CPU 시간 (마이크로초, -1 = 아직 회수 안 됨)
+    long voluntary_switches;
+    long involuntary_switches;
+} PCBCold;
+
+// 실행 설정 (같은 설정과 작업 부하로 여러 정책을 실행해 비교)
+typedef struct {
+    int num_processes;
+    int time_quantum;
+    int max_burst;          // CPU 버스트 최대값
+    int max_io;             // I/O 시간 최대값
+    unsigned int seed;      // 프로세스별 난수열의 시드 (같은 시드면 정책과 관계없이 같은 버스트/I/O)
+    int virtual_mode;       // 1 = 타이머/자식 프로세스 없이 다음 이벤트 시점으로 바로 건너뜀
+    int verbose;            // 이벤트 로그 출력 수준 (enum LogLevel, 0 = 출력 안 함)
+    int gantt_from;         // 간트 차트 출력 시작 틱
+    int gantt_to;           // 출력 끝 틱 (-1 = 시작부터 GANTT_WIDTH칸)
+    const char *trace_path; // 바이너리 트레이스 파일 (NULL = 기록 안 함)
+    int rt_horizon;         // 실시간 태스크가 새 작업을 릴리스하는 마지막 시간 (미만)
+    int num_cpus;           // 시뮬레이션 CPU 수 (CPU마다 준비 큐)
+    int migration_penalty;  // 다른 CPU로 옮겨 실행할 때 캐시 워밍업으로 진행 없이 쓰는 틱
+    int aging_interval;     // 우선순위 정책의 에이징 간격 (틱, 1 이상)
+    int aging_amount;       // 에이징 시 우선순위 증가량
+    const char *job_path;   // 작업 트레이스 파일 (NULL = Workload 사용, 가상 시간 모드 전용)
+    int time_scale;         // SWF 트레이스: 1틱 = time_scale초
+    double arrival_rate;    // 포아송 도착률 (틱당 작업 수, 0 = 닫힌 시스템, 가상 시간 모드 전용)
+                            // 도착하는 작업 수 = num_processes (0 = 무제한)
+    int report_interval;    // 열린 시스템의 구간 보고 간격 (틱, 0 = 보고 안 함)
+    int real_exec;          // 1 = 자식이 실제로 CPU를 쓰고 디스패치/선점을 SIGCONT/SIGSTOP으로 반영 (실시간 틱 모드 전용)
+    int tick_us;            // 실시간 틱 모드의 틱 간격 (마이크로초)
+    const char *latency_path;   // 지연 히스토그램 CSV (NULL = 내보내지 않음, 실시간 틱 모드)
+    int control;            // enum Control (실시간 틱 모드)
+    int spin;               // futex 제어: 자식이 잠들기 전에 명령 번호를 확인하는 횟수
+    int spawn;              // enum Spawn (실시간 틱 모드)
+} SimConfig;
+
+// 작업 부하: 프로세스별 첫 CPU 버스트와 우선순위 (이후 버스트/I/O는 프로세스별 난수열로 생성)
+// 실시간 태스크 집합이면 첫 버스트 = 첫 작업의 실행 시간이고, 이후 작업은 주기마다 릴리스
+typedef struct {
+    int count;
+    int *cpu_burst;
+    int *priority;
+    int *period;            // 실시간 태스크 (NULL = 일반 작업 부하)
+    int *wcet;
+    int *deadline;          // 상대 데드라인
+    int *sporadic;
+} Workload;
+
+// 정책 비교용 요약
+typedef struct {
+    int total_time;
+    int completed;
+    double avg_wait_time;
+    double avg_turnaround;
+    double avg_response;    // 생성부터 첫 디스패치까지
+    double avg_io_response; // I/O 완료부터 다음 디스패치까지 (대화형 응답성)
+    int dispatches;         // 문맥 교환 (디스패치) 횟수
+    int jobs;               // 실시간 작업 수 (0 = 일반 작업 부하)
+    int deadline_misses;
+} SimResult;
+
+// 실시간 틱 모드의 스케줄러 비용 (signals는 실제 실행 모드 전용)
+typedef struct {
+    long long signals;          // 보낸 SIGSTOP/SIGCONT 수
+    long long parent_cpu_us;    // 실행 동안 스케줄러(부모)가 쓴 CPU 시간
+    long long commands;         // 자식에게 보낸 실행/종료 명령 수
+    long long wakes;            // futex 제어: 잠든 자식을 깨운 FUTEX_WAKE 수
+    long long spawn_ns;         // 자식을 모두 만드는 데 걸린 시간
+} ExecStats;
+
+// 제어 경로 지연 (실시간 틱 모드, CLOCK_MONOTONIC 나노초)
+typedef struct {
+    LatencyHist delivery;       // 부모가 실행 명령(SIGUSR1 또는 futex)을 보낸 뒤 자식이 받기까지
+    LatencyHist jitter;         // 타이머 만료 예정 시각 뒤 틱 처리를 시작하기까지
+    LatencyHist tick_work;      // 틱 처리 시간 (스케줄링 결정 + 자식에게 보내는 시그널)
+} LatencyStats;
+
+// 이벤트 로그 레코드 종류 (인자는 엔진의 format_event 참고)
+enum LogEvent {
+    EVENT_ARRIVAL_JOB,      // 프로세스, 첫 버스트, 우선순위, 버스트 수 (작업 트레이스)
+    EVENT_ARRIVAL,          // 프로세스, 첫 버스트, 우선순위 (포아송)
+    EVENT_DISPATCH_CPU,     // CPU, 프로세스, 남은 버스트, 이주 여부
+    EVENT_DISPATCH_QUANTUM, // 프로세스, 남은 버스트, 남은 퀀텀
+    EVENT_DISPATCH,         // 프로세스, 남은 버스트
+    EVENT_QUANTUM,          // 프로세스
+    EVENT_QUANTUM_RESET,
+    EVENT_IO_REQUEST,       // 프로세스, I/O 시간
+    EVENT_IO_DONE,          // 프로세스
+    EVENT_EXIT,             // 프로세스, 완료 수, 전체 수
+    EVENT_EXIT_OPEN,        // 프로세스, 완료 수, 실행 중인 수
+    EVENT_JOB_DONE,         // 태스크, 데드라인, 지연 (음수 = 여유)
+    EVENT_AGING_TOP,        // 프로세스, 초기 우선순위
+    EVENT_MLFQ_DEMOTE,      // 프로세스, 레벨, 허용량, 새 레벨
+    EVENT_MLFQ_BOOST,
+    EVENT_SEPARATOR
+};
+
+// 실시간 틱 모드에서 부모가 자식에게 명령을 전하는 방법
+enum Control {
+    CONTROL_SIGNAL,     // 틱마다 kill(SIGUSR1), 종료는 SIGTERM
+    CONTROL_FUTEX       // 공유 메모리 제어 칸 + futex 대기/깨우기
+};
+
+enum ChildCommand { CHILD_RUN = 1, CHILD_EXIT };
+
+// 실시간 틱 모드의 자식 생성 방법
+enum Spawn {
+    SPAWN_FORK,         // fork 후 같은 코드에서 자식 루프 실행
+    SPAWN_POSIX         // posix_spawn으로 이 실행 파일을 CHILD_ARG 모드로 다시 실행
+};
+#define CHILD_ARG "--sched-child"   // 실행 파일이 main 첫머리에서 확인해 sim_child_main으로 넘김
+
+// 자식과 공유하는 제어/측정 칸 (MAP_SHARED, 자식의 PCB 인덱스별)
+// 부모가 sent_ns를 쓰고 명령을 보내면, 자식이 받은 시각과의 차이를 쓰고 acked를 올림
+// 명령이 겹쳐 하나로 전달되면 마지막 전송 기준 표본 하나만 남음
+typedef struct {
+    atomic_uint seq;            // futex 제어: 명령 번호 (futex 대기 주소)
+    atomic_uint command;        // enum ChildCommand
+    atomic_int parked;          // 1 = 자식이 futex로 잠들었거나 잠들려는 중 (부모가 깨워야 함)
+    atomic_llong sent_ns;
+    atomic_llong delivery_ns;
+    atomic_uint acked;
+    unsigned int collected;     // 부모가 히스토그램에 넣은 acked (부모 전용)
+} ChildProbe;
+
+// 열린 시스템의 구간 통계 (report_interval 틱마다 출력하고 다시 시작)
+typedef struct {
+    int start;                  // 구간 시작 틱
+    long long arrivals;
+    long long completions;
+    long long turnaround;       // 구간에 끝난 프로세스의 턴어라운드 합
+    int max_turnaround;
+    long long ready_area;       // 틱마다 준비 큐 길이(모든 CPU 합)를 더한 값 (평균 = ready_area / 틱 수)
+    long long busy_ticks;       // 구간 시작 시점의 CPU 바쁜 틱 합 (차이로 사용률 계산)
+} IntervalStats;
+
+typedef struct Sim Sim;
+
+// CPU별 상태와 통계
+typedef struct {
+    int current;                // 실행 중인 프로세스 (-1 = 유휴)
+    int executed;               // 이번 틱에 실행한 프로세스 (간트 기록용, -1 = 유휴)
+    int nr_ready;               // 이 CPU 준비 큐에 있는 프로세스 수
+    long long busy_ticks;
+    long long penalty_ticks;    // 이주 직후 캐시 워밍업으로 쓴 틱
+    long long dispatches;
+    long long migrations;       // 다른 CPU에서 마지막으로 실행한 프로세스를 디스패치한 횟수
+    long long steals;           // 유휴 상태에서 다른 CPU 큐의 프로세스를 가져온 횟수
+    GanttLog log;               // 틱별 실행 프로세스 (상태 코드 = 인덱스 + 1, 0 = 유휴)
+} CpuState;
+
+// 스케줄링 정책 인터페이스
+// 엔진은 READY 진입 시 enqueue, 디스패치할 때 pick_next를 부르고, 정책은 자기 준비 큐만 관리
+// 다중 CPU를 지원하는 정책은 CPU마다 준비 큐를 두고 enqueue는 pcb_cpu[index], pick_next는 current_cpu의 큐를 사용
+typedef struct {
+    const char *name;       // 명령행 이름 (-p 옵션)
+    const char *title;      // 출력용 이름
+    int uses_quantum;       // 1 = 실행 중 remaining_quantum을 줄이고 0이 되면 선점
+
+    void (*init)(Sim *sim);                         // 정책 상태 할당, PCB 열 등록
+    void (*admit)(Sim *sim, int index);             // 새 프로세스의 정책 필드 초기화, 첫 enqueue 전에 호출 (NULL 가능)
+    void (*enqueue)(Sim *sim, int index);           // READY 진입 (생성, 퀀텀 만료, I/O 완료)
+    int (*pick_next)(Sim *sim);                     // 다음 실행할 프로세스를 준비 큐에서 꺼냄 (-1 = 없음)
+    void (*remove)(Sim *sim, int index);            // READY 프로세스를 준비 큐 중간에서 뺌 (외부 종료, NULL = 준비 큐 없음)
+    void (*on_tick)(Sim *sim);                      // 매 틱 시작 (NULL 가능)
+    void (*on_quantum_expiry)(Sim *sim, int index); // 퀀텀 만료, enqueue 전에 호출 (NULL 가능)
+    void (*on_io_complete)(Sim *sim, int index);    // I/O 완료, enqueue 전에 호출 (NULL 가능)
+    int (*next_event)(Sim *sim);                    // 가상 시간 모드: 정책 자체 이벤트까지 남은 틱 (NULL 가능, -1 = 없음)
+    int (*steal)(Sim *sim, int cpu);                // 다중 CPU: cpu의 준비 큐에서 다른 CPU로 옮길 프로세스를 꺼냄 (NULL = 단일 CPU 전용)
+    void (*print_stats)(Sim *sim);                  // 정책별 추가 통계 (NULL 가능)
+    void (*destroy)(Sim *sim);                      // 정책 상태 해제 (NULL 가능)
+} Policy;
+
+struct Sim {
+    const Policy *policy;
+    void *policy_data;      // 정책 전용 상태
+    SimConfig config;
+
+    // PCB: 필드별 배열(SoA)로 나눠 PCB 아레나에 저장
+    // 핫 필드 - 틱/디스패치마다 접근하는 연속 배열
+    PCBArena arena;
+    enum State *pcb_state;
+    int *pcb_remaining_quantum;
+    int *pcb_cpu_burst;         // 부모가 관리하는 CPU 버스트
+    int *pcb_ready_since;       // READY 진입 시간 (-1 = READY 아님)
+    int *pcb_run_ticks;         // 지금까지 실행한 틱 수
+    int *pcb_deadline;          // 현재 작업의 절대 데드라인 (INT_MAX = 데드라인 없음)
+    int *pcb_cpu;               // 속한 준비 큐의 CPU (실행 중이면 실행 CPU, 잠들었으면 마지막 CPU)
+    int *pcb_last_cpu;          // 마지막으로 실행한 CPU (-1 = 아직 실행 안 함)
+    int *pcb_penalty;           // 남은 이주 페널티 틱
+    unsigned int *pcb_rng;      // 프로세스별 난수 상태 (버스트/I/O/종료 결정)
+    PCBCold *pcb_cold;
+
+    int num_processes;
+    volatile int completed_processes;
+    int current_time;
+    int dispatches;
+    long long io_response_total;    // I/O 완료 → 디스패치 지연 합
+    long long io_responses;
+
+    // CPU: 각자 실행 중인 프로세스와 준비 큐 (정책의 pick_next는 current_cpu의 큐에서 선택)
+    int num_cpus;
+    int current_cpu;
+    CpuState *cpus;
+    long long balance_moves;    // 주기적 부하 균형으로 옮긴 프로세스 수
+
+    // I/O 완료 타이머 휠 (틱마다 이번 슬롯에서 깨어나는 프로세스만 처리)
+    TimerWheel io_wheel;
+    int *wake_buf;              // 이번 틱에 깨어난 프로세스 (PCB 저장소의 열)
+
+    // SIGCHLD 처리용 pid → 인덱스 해시 테이블 (fork 시 등록)
+    PidTable pid_index;
+
+    // 간트 차트: 프로세스별 상태 구간 로그, 상태가 바뀐 프로세스만 틱 끝에 기록
+    GanttLog *gantt_logs;
+    int *gantt_dirty;
+    int *gantt_marked;
+    int gantt_dirty_count;
+    int gantt_until;            // 이 틱 이후는 기록 안 함 (닫힌 시스템 = INT_MAX, 열린 시스템 = 출력 창 끝)
+
+    TraceRing trace;
+
+    // 작업 트레이스: 도착 시간이 된 작업을 틱마다 읽어 프로세스로 생성
+    JobStream jobs;
+    int streaming;              // 1 = 작업 트레이스 재생 중 (jobs가 열려 있음)
+
+    // 열린 시스템: 작업이 실행 중에 도착하고 끝난 PCB 슬롯은 빈 슬롯 목록으로 돌아가 재사용
+    // (PCB 저장소 크기 = 동시에 살아 있던 최대 프로세스 수, 인덱스 = 슬롯 번호)
+    int open;                   // 1 = 포아송 도착 또는 작업 트레이스
+    int *pcb_free_next;         // 빈 슬롯 목록의 다음 슬롯 (PCB 저장소의 열, -1 = 끝)
+    int free_head;              // 빈 슬롯 목록의 첫 슬롯 (-1 = 없음)
+    int live;                   // 살아 있는 (DONE이 아닌) 프로세스 수
+    int peak_live;              // 동시에 살아 있던 최대 프로세스 수
+    long long arrivals;         // 지금까지 만든 프로세스 수 (프로세스별 난수열 시드와 첫 CPU 배치에 사용)
+    unsigned int arrival_rng;   // 포아송 도착 간격, 첫 버스트, 우선순위 (정책과 무관한 난수열)
+    double arrival_clock;       // 다음 포아송 도착의 연속 시간
+    IntervalStats interval;
+    long long ready_area;       // 전체 실행의 준비 큐 길이 누적 (평균 준비 큐 길이용)
+    ExecStats exec;
+    LatencyStats latency;
+    EventLog log;               // 틱 처리의 이벤트 출력 (메인 루프가 비움)
+    ChildProbe *probes;         // 실시간 틱 모드 (NULL = 가상 시간 모드)
+    int probe_fd;               // posix_spawn 자식에게 넘기는 probes의 memfd (-1 = 익명 매핑)
+
+    // 끝난 프로세스의 누적 통계 (슬롯이 재사용돼도 남도록 종료할 때 더함)
+    long long total_wait;
+    long long total_turnaround;
+    long long total_response;
+
+    // 실시간 작업별 지연 (완료 - 데드라인), 작업 수 상한으로 미리 할당 (NULL = 일반 작업 부하)
+    int *lateness;
+    int lateness_count;
+};
+
+// 엔진 (sched_engine.c)
+void sim_init(Sim *sim, const Policy *policy, const SimConfig *config);
+void sim_run(Sim *sim, const Workload *workload);
+void sim_print_gantt_chart(Sim *sim);
+void sim_print_statistics(Sim *sim);
+void sim_summarize(Sim *sim, SimResult *result);
+void sim_free(Sim *sim);
+int sim_wait_time(Sim *sim, int index);
+int sim_child_main(int argc, char *argv[]);
+
+// 정책 플러그인 (policy_*.c)
+extern const Policy fifo_policy;
+extern const Policy rr_policy;
+extern const Policy priority_policy;
+extern const Policy cfs_policy;
+extern const Policy mlfq_policy;
+extern const Policy sjf_policy;
+extern const Policy srtf_policy;
+extern const Policy oracle_policy;
+extern const Policy stride_policy;
+extern const Policy lottery_policy;
+extern const Policy edf_policy;
+
+#endif
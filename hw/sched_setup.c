@@ -0,0 +1,191 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "sched_setup.h"
+
+#define MIN_RT_PERIOD 10        // 실시간 태스크 주기 범위
+#define MAX_RT_PERIOD 100
+
+const Policy *const registered_policies[] = {
+    &fifo_policy,
+    &rr_policy,
+    &priority_policy,
+    &cfs_policy,
+    &mlfq_policy,
+    &sjf_policy,
+    &srtf_policy,
+    &oracle_policy,
+    &stride_policy,
+    &lottery_policy,
+    &edf_policy,
+};
+const int num_registered_policies = (int)(sizeof(registered_policies) / sizeof(registered_policies[0]));
+
+// 명령행 옵션이 없을 때의 설정 (시드는 호출자가 정함)
+void sim_default_config(SimConfig *config) {
+    memset(config, 0, sizeof(SimConfig));
+    config->num_processes = DEFAULT_PROCESSES;
+    config->time_quantum = 3;
+    config->max_burst = DEFAULT_MAX_BURST;
+    config->max_io = MAX_IO_TIME;
+    config->verbose = LOG_DETAIL;
+    config->gantt_from = 1;
+    config->gantt_to = -1;
+    config->trace_path = NULL;
+    config->rt_horizon = DEFAULT_RT_HORIZON;
+    config->num_cpus = 1;
+    config->migration_penalty = DEFAULT_MIGRATION_PENALTY;
+    config->aging_interval = DEFAULT_AGING_INTERVAL;
+    config->aging_amount = DEFAULT_AGING_AMOUNT;
+    config->job_path = NULL;
+    config->time_scale = 1;
+    config->arrival_rate = 0;
+    config->report_interval = DEFAULT_REPORT_INTERVAL;
+    config->real_exec = 0;
+    config->tick_us = DEFAULT_TICK_US;
+    config->latency_path = NULL;
+    config->control = CONTROL_SIGNAL;
+    config->spin = 0;
+    config->spawn = SPAWN_FORK;
+}
+
+const Policy *find_policy(const char *name) {
+    for (int k = 0; k < num_registered_policies; k++) {
+        if (strcmp(registered_policies[k]->name, name) == 0) {
+            return registered_policies[k];
+        }
+    }
+    return NULL;
+}
+
+// 쉼표로 구분한 정책 이름 목록 ("all" = 등록된 모든 정책)
+int parse_policies(char *list, const Policy **out) {
+    int count = 0;
+
+    for (char *name = strtok(list, ","); name != NULL; name = strtok(NULL, ",")) {
+        if (strcmp(name, "all") == 0) {
+            for (int k = 0; k < num_registered_policies && count < MAX_POLICIES; k++) {
+                out[count++] = registered_policies[k];
+            }
+            continue;
+        }
+        const Policy *policy = find_policy(name);
+        if (policy == NULL) {
+            fprintf(stderr, "알 수 없는 정책: %s\n", name);
+            exit(1);
+        }
+        if (count == MAX_POLICIES) {
+            fprintf(stderr, "정책은 최대 %d개까지 지정할 수 있습니다.\n", MAX_POLICIES);
+            exit(1);
+        }
+        out[count++] = policy;
+    }
+    if (count == 0) {
+        fprintf(stderr, "정책을 하나 이상 지정해야 합니다.\n");
+        exit(1);
+    }
+    return count;
+}
+
+// 프로세스별 첫 CPU 버스트(시드로 생성하거나 -i로 직접 입력)와 우선순위
+// 우선순위는 P0=0(최고)부터 차례로 (레벨 수를 넘으면 반복) - 에이징 효과 확인용
+void make_workload(Workload *workload, const SimConfig *config, int read_stdin) {
+    int count = config->num_processes;
+    unsigned int rng = config->seed;
+    char input[100];
+
+    workload->count = count;
+    workload->cpu_burst = malloc(sizeof(int) * count);
+    workload->priority = malloc(sizeof(int) * count);
+    workload->period = workload->wcet = workload->deadline = workload->sporadic = NULL;
+    if (workload->cpu_burst == NULL || workload->priority == NULL) {
+        perror("작업 부하 할당 실패");
+        exit(1);
+    }
+
+    if (read_stdin) {
+        printf("각 프로세스의 CPU 버스트 값을 입력하세요 (1-%d):\n", config->max_burst);
+    }
+    for (int i = 0; i < count; i++) {
+        workload->priority[i] = i % (MAX_PRIORITY - MIN_PRIORITY + 1);
+        if (!read_stdin) {
+            workload->cpu_burst[i] = (rand_r(&rng) % config->max_burst) + 1;
+            continue;
+        }
+        while (1) {
+            printf("  프로세스 %d의 CPU 버스트: ", i);
+            fflush(stdout);
+            if (fgets(input, sizeof(input), stdin) == NULL) {
+                fprintf(stderr, "\n입력이 끝났습니다.\n");
+                exit(1);
+            }
+            if (input[0] != '\n') {
+                int burst = atoi(input);
+                if (burst >= 1 && burst <= config->max_burst) {
+                    workload->cpu_burst[i] = burst;
+                    break;
+                } else {
+                    printf("    잘못된 값입니다. 1-%d 사이의 값을 입력하세요.\n", config->max_burst);
+                }
+            } else {
+                printf("    값을 입력해주세요.\n");
+            }
+        }
+    }
+    if (read_stdin) {
+        printf("\n");
+    }
+}
+
+// 실시간 태스크 집합: UUniFast로 목표 사용률을 태스크별로 고르게 나누고 (Bini & Buttazzo)
+// 주기 MIN_RT_PERIOD..MAX_RT_PERIOD, WCET = 사용률 × 주기, 데드라인은 주기의 3/4..1 (WCET 이상)
+// 세 번째 태스크마다 산발적 (주기 = 최소 도착 간격), 첫 작업 실행 시간은 엔진과 같은 규칙
+void make_rt_workload(Workload *workload, const SimConfig *config, double utilization) {
+    int count = config->num_processes;
+    unsigned int rng = config->seed;
+    double remaining = utilization;
+
+    workload->count = count;
+    workload->cpu_burst = malloc(sizeof(int) * count);
+    workload->priority = malloc(sizeof(int) * count);
+    workload->period = malloc(sizeof(int) * count);
+    workload->wcet = malloc(sizeof(int) * count);
+    workload->deadline = malloc(sizeof(int) * count);
+    workload->sporadic = malloc(sizeof(int) * count);
+    if (workload->cpu_burst == NULL || workload->priority == NULL || workload->period == NULL ||
+        workload->wcet == NULL || workload->deadline == NULL || workload->sporadic == NULL) {
+        perror("작업 부하 할당 실패");
+        exit(1);
+    }
+
+    for (int i = 0; i < count; i++) {
+        double share = remaining;
+        if (i < count - 1) {
+            double next = remaining * pow(rand_r(&rng) / (RAND_MAX + 1.0), 1.0 / (count - i - 1));
+            share = remaining - next;
+            remaining = next;
+        }
+        int period = MIN_RT_PERIOD + rand_r(&rng) % (MAX_RT_PERIOD - MIN_RT_PERIOD + 1);
+        int wcet = (int)(share * period + 0.5);
+        if (wcet < 1) wcet = 1;
+        if (wcet > period) wcet = period;
+
+        workload->period[i] = period;
+        workload->wcet[i] = wcet;
+        workload->deadline[i] = period - rand_r(&rng) % ((period - wcet) / 4 + 1);
+        workload->sporadic[i] = i % 3 == 2;
+        workload->priority[i] = i % (MAX_PRIORITY - MIN_PRIORITY + 1);
+        workload->cpu_burst[i] = wcet - rand_r(&rng) % ((wcet + 1) / 2);
+    }
+}
+
+void free_workload(Workload *workload) {
+    free(workload->cpu_burst);
+    free(workload->priority);
+    free(workload->period);
+    free(workload->wcet);
+    free(workload->deadline);
+    free(workload->sporadic);
+}
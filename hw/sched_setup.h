@@ -0,0 +1,27 @@
+#ifndef SCHED_SETUP_H
+#define SCHED_SETUP_H
+
+#include "sched_engine.h"
+
+// 실행 준비: 정책 목록, 기본 설정, 작업 부하 생성 (scheduler와 sweep이 공유)
+#define DEFAULT_PROCESSES 10    // -n 옵션이 없을 때 프로세스 수
+#define DEFAULT_MAX_BURST 10    // -b 옵션이 없을 때 CPU 버스트 최대값
+#define MAX_IO_TIME 5
+#define MAX_POLICIES 16
+#define DEFAULT_MIGRATION_PENALTY 2  // -m 옵션이 없을 때 다른 CPU로 옮겨 간 뒤의 캐시 워밍업 틱
+#define DEFAULT_TICK_US 100000  // -u 옵션이 없을 때 실시간 틱 모드의 틱 간격 (마이크로초)
+#define MIN_TICK_US 1000
+#define DEFAULT_RT_HORIZON 200  // -H 옵션이 없을 때 실시간 태스크의 릴리스 기간
+
+// 선택 가능한 정책 (등록 순서 = "all"을 펼치는 순서)
+extern const Policy *const registered_policies[];
+extern const int num_registered_policies;
+
+void sim_default_config(SimConfig *config);
+const Policy *find_policy(const char *name);
+int parse_policies(char *list, const Policy **out);
+void make_workload(Workload *workload, const SimConfig *config, int read_stdin);
+void make_rt_workload(Workload *workload, const SimConfig *config, double utilization);
+void free_workload(Workload *workload);
+
+#endif
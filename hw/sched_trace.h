@@ -0,0 +1,157 @@
+#ifndef SCHED_TRACE_H
+#define SCHED_TRACE_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+
+#include "spsc_ring.h"
+
+// 바이너리 스케줄링 트레이스
+// 틱 처리는 고정 크기 레코드를 링(spsc_ring.h)에 넣기만 하고,
+// 메인 루프가 링을 비워 mmap한 파일에 이어 씀 (틱 처리 중에는 시스템 콜/할당 없음)
+// 파일 형식: TraceHeader 다음에 TraceEvent가 event_count개 (trace_analyzer로 분석)
+#define TRACE_MAGIC "SCHTRC2"         // 이벤트 번호가 바뀌면 올림
+#define TRACE_RING_SIZE 65536           // 링 버퍼 레코드 수 (2의 거듭제곱)
+#define TRACE_FILE_CHUNK (1 << 20)      // 파일 최소 확장 단위 (바이트)
+
+enum TraceType {
+    TRACE_CREATE = 1,   // 프로세스 생성, READY 진입 (arg = CPU 버스트)
+    TRACE_DISPATCH,     // READY → RUNNING (arg = 남은 CPU 버스트)
+    TRACE_PREEMPT,      // 타임 퀀텀 만료, RUNNING → READY (arg = 우선순위)
+    TRACE_SLEEP,        // I/O 요청, RUNNING → SLEEP (arg = I/O 완료 시간)
+    TRACE_WAKE,         // I/O 완료, SLEEP → READY (arg = 우선순위)
+    TRACE_AGING,        // 에이징/강등으로 우선순위 변경 (arg = 새 우선순위 또는 MLFQ 레벨)
+    TRACE_EXIT,         // 종료 (DONE)
+    TRACE_TICK          // 간트 차트 기록 시점 (process = 이번 틱에 실행한 프로세스, -1 = 없음, arg = CPU)
+                        // 다중 CPU면 같은 시간의 TICK이 CPU마다 하나씩 연속으로 기록됨
+};
+
+typedef struct {
+    int32_t time;       // 시뮬레이션 시간 (틱)
+    int32_t process;    // 프로세스 인덱스
+    int32_t arg;
+    uint8_t type;       // enum TraceType
+    uint8_t reserved[3];
+} TraceEvent;           // 16바이트
+
+typedef struct {
+    char magic[8];
+    char policy[16];    // 스케줄링 알고리즘 이름
+    int32_t num_processes;
+    int32_t time_quantum;
+    int32_t end_time;   // 총 시뮬레이션 시간
+    int32_t num_cpus;   // 0 = 단일 CPU (이전 형식)
+    uint64_t event_count;
+    uint64_t dropped;   // 링이 가득 차 버린 레코드 수
+} TraceHeader;
+
+typedef struct {
+    SpscRing ring;
+    int enabled;
+    int fd;
+    char *map;          // mmap한 파일 (헤더 + 레코드)
+    size_t map_size;
+    uint64_t written;   // 파일에 쓴 레코드 수
+} TraceRing;
+
+static inline void trace_map(TraceRing *tr, size_t size) {
+    if (tr->map != NULL) {
+        munmap(tr->map, tr->map_size);
+    }
+    if (ftruncate(tr->fd, (off_t)size) != 0) {
+        perror("트레이스 파일 확장 실패");
+        exit(1);
+    }
+    tr->map = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, tr->fd, 0);
+    if (tr->map == MAP_FAILED) {
+        perror("트레이스 파일 mmap 실패");
+        exit(1);
+    }
+    tr->map_size = size;
+}
+
+// 링의 레코드 하나를 파일 끝에 씀 (자리가 없으면 파일을 두 배로 확장)
+static inline void trace_write_record(void *ctx, const void *record) {
+    TraceRing *tr = ctx;
+    size_t needed = sizeof(TraceHeader) + (tr->written + 1) * sizeof(TraceEvent);
+
+    if (needed > tr->map_size) {
+        trace_map(tr, tr->map_size * 2);
+    }
+    ((TraceEvent *)(tr->map + sizeof(TraceHeader)))[tr->written++] = *(const TraceEvent *)record;
+}
+
+// path에 트레이스 파일 생성 (호출하지 않으면 trace_emit은 아무것도 하지 않음)
+static inline void trace_open(TraceRing *tr, const char *path, const char *policy,
+                              int num_processes, int time_quantum, int num_cpus, int sync) {
+    tr->fd = open(path, O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (tr->fd == -1) {
+        perror("트레이스 파일 열기 실패");
+        exit(1);
+    }
+    ring_open(&tr->ring, sizeof(TraceEvent), TRACE_RING_SIZE, sync, trace_write_record, tr);
+    tr->written = 0;
+    tr->map = NULL;
+    trace_map(tr, TRACE_FILE_CHUNK);
+
+    TraceHeader *header = (TraceHeader *)tr->map;
+    memset(header, 0, sizeof(TraceHeader));
+    memcpy(header->magic, TRACE_MAGIC, sizeof(TRACE_MAGIC));
+    strncpy(header->policy, policy, sizeof(header->policy) - 1);
+    header->num_processes = num_processes;
+    header->time_quantum = time_quantum;
+    header->num_cpus = num_cpus;
+    tr->enabled = 1;
+}
+
+// 링에 쌓인 레코드를 파일로 옮김 (메인 루프에서 호출)
+static inline void trace_drain(TraceRing *tr) {
+    if (tr->enabled) {
+        ring_drain(&tr->ring);
+    }
+}
+
+// 레코드 하나 추가
+static inline void trace_emit(TraceRing *tr, int type, int time, int process, int arg) {
+    if (!tr->enabled) {
+        return;
+    }
+    TraceEvent *ev = ring_reserve(&tr->ring);
+    if (ev == NULL) {
+        return;
+    }
+    ev->time = time;
+    ev->process = process;
+    ev->arg = arg;
+    ev->type = (uint8_t)type;
+    ring_commit(&tr->ring);
+}
+
+// 남은 레코드를 쓰고 헤더를 채운 뒤 파일을 실제 크기로 줄여 닫음
+static inline void trace_close(TraceRing *tr, int end_time, int num_processes) {
+    if (!tr->enabled) {
+        return;
+    }
+    ring_close(&tr->ring);
+    tr->enabled = 0;
+
+    TraceHeader *header = (TraceHeader *)tr->map;
+    header->end_time = end_time;
+    header->num_processes = num_processes;  // 작업 트레이스 재생은 열 때 프로세스 수를 모름
+    header->event_count = tr->written;
+    header->dropped = tr->ring.dropped;
+    munmap(tr->map, tr->map_size);
+    if (ftruncate(tr->fd, (off_t)(sizeof(TraceHeader) + tr->written * sizeof(TraceEvent))) != 0) {
+        perror("트레이스 파일 정리 실패");
+    }
+    close(tr->fd);
+    printf("[트레이스] 이벤트 %llu개 기록 (버림: %lu개)\n",
+           (unsigned long long)tr->written, tr->ring.dropped);
+}
+
+#endif
@@ -1,500 +1,298 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <unistd.h>
-#include <signal.h>
-#include <sys/types.h>
-#include <sys/wait.h>
-#include <sys/time.h>
 #include <time.h>
-#include <string.h>
 
-#define MAX_PROCESSES 50
-#define MAX_TIME_QUANTUM 10
-#define MAX_CPU_BURST 10
-#define MAX_IO_TIME 5
+#include "sched_setup.h"
 
-// 프로세스 상태
-enum State {
-    READY,
-    RUNNING,
-    SLEEP,
-    DONE
-};
-
-// PCB (프로세스 제어 블록) 구조체
-typedef struct {
-    pid_t pid;
-    int remaining_quantum;
-    int cpu_burst;          // 부모가 관리하는 CPU 버스트
-    int io_wait_time;
-    enum State state;
-    int wait_time;
-    int start_time;
-    int completion_time;
-} PCB;
-
-// 전역 변수
-PCB pcb_table[MAX_PROCESSES];
-const int num_processes = 10;  // 프로세스 수 10개 고정
-int current_process = -1;
-int last_scheduled = -1;  // 마지막으로 스케줄된 프로세스 (라운드 로빈용)
-int timer_count = 0;
-volatile int completed_processes = 0;
-int time_quantum = 3;  // 기본값
-int current_time = 0;
-
-// 간트 차트용 배열 (각 시간, 각 프로세스의 상태 기록)
-#define MAX_TIME 500
-int gantt_chart[MAX_PROCESSES][MAX_TIME];  // 0=없음, 1=READY, 2=RUNNING, 3=SLEEP
-
-// 시그널 마스크 (모든 핸들러에서 사용)
-sigset_t block_mask;
+// 함수 원형
+static void print_usage(const char *prog);
 
-// 시그널 핸들러
-void parent_timer_handler(int sig);
-void parent_child_handler(int sig);
-void child_signal_handler(int sig);
+int main(int argc, char *argv[]) {
+    SimConfig config;
+    const Policy *selected[MAX_POLICIES];
+    int num_selected = 0;
+    char default_policy[] = "rr";
+    char *policy_list = default_policy;
+    int read_stdin = 0;
+    int force_log = 0;
+    int log_level = -1;
+    double rt_utilization = 0;
+    int opt;
 
-// 함수 원형
-void initialize_pcb(int index, pid_t pid, int cpu_burst);
-int find_next_ready_process();
-void schedule_next_process();
-void update_wait_times();
-void print_status();
-void calculate_statistics();
-void reset_all_quantum();
-int find_process_by_pid(pid_t pid);
-void print_gantt_chart();
+    // posix_spawn으로 다시 실행된 자식 (-P spawn)
+    if (argc > 1 && strcmp(argv[1], CHILD_ARG) == 0) {
+        return sim_child_main(argc, argv);
+    }
 
-// 자식 프로세스용 전역 변수
-volatile int child_should_exit = 0;
+    sim_default_config(&config);
+    config.seed = (unsigned int)time(NULL);
 
-int main(int argc, char *argv[]) {
-    pid_t child_pids[MAX_PROCESSES];
-    char input[100];
-    
-    // 타임 퀀텀 입력 받기
-    printf("타임 퀀텀을 입력해주세요 (기본값: 3, 최대: %d): ", MAX_TIME_QUANTUM);
-    fflush(stdout);
-    if (fgets(input, sizeof(input), stdin) != NULL && input[0] != '\n') {
-        int temp = atoi(input);
-        if (temp > 0 && temp <= MAX_TIME_QUANTUM) {
-            time_quantum = temp;
-        } else {
-            printf("잘못된 값입니다. 기본값 3을 사용합니다.\n");
-            time_quantum = 3;
+    // 명령행 옵션: -p 정책 목록, -q 타임 퀀텀, -b 최대 CPU 버스트, -i 첫 버스트 직접 입력, -e 이벤트 로그,
+    // -v 가상 시간 모드, -s 난수 시드 (같은 시드면 두 모드/모든 정책에서 같은 작업 부하), -n 프로세스 수,
+    // -g 간트 차트 시간 창, -t 트레이스 파일, -R 실시간 태스크 집합 (목표 사용률), -H 릴리스 기간,
+    // -c CPU 수, -m 이주 비용, -a 에이징 간격, -A 에이징 증가량, -w 작업 트레이스 파일, -T SWF 초/틱,
+    // -O 포아송 도착률 (열린 시스템, -n = 도착할 작업 수, 0 = 무제한), -r 구간 보고 간격,
+    // -x 실제 실행 (자식이 CPU를 쓰고 SIGSTOP/SIGCONT로 선점), -u 실시간 틱 간격 (마이크로초),
+    // -L 지연 히스토그램 CSV 파일, -K 자식 제어 방법 (signal|futex), -S futex 제어의 잠들기 전 확인 횟수,
+    // -P 자식 생성 방법 (fork|spawn), -V 이벤트 로그 수준 (0 없음, 1 도착/종료, 2 전체)
+    while ((opt = getopt(argc, argv, "p:q:b:ievs:n:g:t:R:H:c:m:a:A:w:T:O:r:xu:L:K:S:P:V:")) != -1) {
+        switch (opt) {
+            case 'p': policy_list = optarg; break;
+            case 'q': config.time_quantum = atoi(optarg); break;
+            case 'b': config.max_burst = atoi(optarg); break;
+            case 'i': read_stdin = 1; break;
+            case 'e': force_log = 1; break;
+            case 'v': config.virtual_mode = 1; break;
+            case 's': config.seed = (unsigned int)strtoul(optarg, NULL, 10); break;
+            case 'n': config.num_processes = atoi(optarg); break;
+            case 'g':
+                if (sscanf(optarg, "%d:%d", &config.gantt_from, &config.gantt_to) < 1 || config.gantt_from < 1) {
+                    fprintf(stderr, "간트 차트 범위는 시작[:끝] 형식 (시작 >= 1)이어야 합니다.\n");
+                    exit(1);
+                }
+                break;
+            case 't': config.trace_path = optarg; break;
+            case 'R': rt_utilization = atof(optarg); break;
+            case 'H': config.rt_horizon = atoi(optarg); break;
+            case 'c': config.num_cpus = atoi(optarg); break;
+            case 'm': config.migration_penalty = atoi(optarg); break;
+            case 'a': config.aging_interval = atoi(optarg); break;
+            case 'A': config.aging_amount = atoi(optarg); break;
+            case 'w': config.job_path = optarg; break;
+            case 'T': config.time_scale = atoi(optarg); break;
+            case 'O': config.arrival_rate = atof(optarg); break;
+            case 'r': config.report_interval = atoi(optarg); break;
+            case 'x': config.real_exec = 1; break;
+            case 'u': config.tick_us = atoi(optarg); break;
+            case 'L': config.latency_path = optarg; break;
+            case 'K':
+                if (strcmp(optarg, "signal") == 0) {
+                    config.control = CONTROL_SIGNAL;
+                } else if (strcmp(optarg, "futex") == 0) {
+                    config.control = CONTROL_FUTEX;
+                } else {
+                    fprintf(stderr, "자식 제어 방법은 signal 또는 futex여야 합니다.\n");
+                    exit(1);
+                }
+                break;
+            case 'S': config.spin = atoi(optarg); break;
+            case 'V': log_level = atoi(optarg); break;
+            case 'P':
+                if (strcmp(optarg, "fork") == 0) {
+                    config.spawn = SPAWN_FORK;
+                } else if (strcmp(optarg, "spawn") == 0) {
+                    config.spawn = SPAWN_POSIX;
+                } else {
+                    fprintf(stderr, "자식 생성 방법은 fork 또는 spawn이어야 합니다.\n");
+                    exit(1);
+                }
+                break;
+            default:
+                print_usage(argv[0]);
+                exit(1);
         }
-    } else {
-        printf("기본값 3을 사용합니다.\n");
-        time_quantum = 3;
     }
-    
-    printf("\n=== OS 스케줄링 시뮬레이션 ===\n");
-    printf("프로세스 수: %d\n", num_processes);
-    printf("타임 퀀텀: %d\n", time_quantum);
-    printf("===============================\n\n");
-    
-    // 간트 차트 배열 초기화
-    for (int p = 0; p < MAX_PROCESSES; p++) {
-        for (int t = 0; t < MAX_TIME; t++) {
-            gantt_chart[p][t] = 0;
-        }
+    if (config.num_processes < (config.arrival_rate > 0 ? 0 : 1)) {
+        fprintf(stderr, "프로세스 수는 1 이상이어야 합니다 (포아송 도착은 0 = 무제한).\n");
+        exit(1);
     }
-    
-    // 시그널 마스크 설정 (핸들러 실행 중 블록할 시그널)
-    sigemptyset(&block_mask);
-    sigaddset(&block_mask, SIGALRM);
-    sigaddset(&block_mask, SIGCHLD);
-    
-    // 난수 생성기 시드 설정
-    srand(time(NULL));
-    
-    // 자식 프로세스 생성
-    for (int i = 0; i < num_processes; i++) {
-        // fork() 전에 CPU 버스트 값 미리 생성 (부모/자식이 같은 값 공유)
-        int initial_burst = (rand() % MAX_CPU_BURST) + 1;
-        
-        pid_t pid = fork();
-        
-        if (pid == 0) {
-            // 자식 프로세스 코드 - 단순히 시그널 대기만 함
-            signal(SIGUSR1, child_signal_handler);
-            signal(SIGTERM, child_signal_handler);
-            
-            // 스케줄링 시그널 대기
-            while (!child_should_exit) {
-                pause();  // 시그널 대기
-            }
-            
-            exit(0);
-        } else if (pid > 0) {
-            // 부모 프로세스
-            child_pids[i] = pid;
-            initialize_pcb(i, pid, initial_burst);
-            printf("[프로세스 %d] CPU 버스트 %d로 생성됨\n", i, pcb_table[i].cpu_burst);
-        } else {
-            perror("Fork 실패");
-            exit(1);
-        }
+    if (config.time_quantum < 1 || config.time_quantum > MAX_TIME_QUANTUM) {
+        fprintf(stderr, "타임 퀀텀은 1-%d 사이여야 합니다.\n", MAX_TIME_QUANTUM);
+        exit(1);
     }
-    
-    // 부모 프로세스 계속 실행
-    // 시그널 핸들러 설정
-    struct sigaction sa_timer, sa_child;
-    
-    // 타이머 핸들러 - 다른 시그널 블록
-    sa_timer.sa_handler = parent_timer_handler;
-    sa_timer.sa_mask = block_mask;
-    sa_timer.sa_flags = SA_RESTART;
-    sigaction(SIGALRM, &sa_timer, NULL);
-    
-    // 자식 종료 핸들러 - 다른 시그널 블록
-    sa_child.sa_handler = parent_child_handler;
-    sa_child.sa_mask = block_mask;
-    sa_child.sa_flags = SA_RESTART;
-    sigaction(SIGCHLD, &sa_child, NULL);
-    
-    // 타이머 설정 (100ms 간격)
-    struct itimerval timer;
-    timer.it_value.tv_sec = 0;
-    timer.it_value.tv_usec = 100000;  // 100ms
-    timer.it_interval.tv_sec = 0;
-    timer.it_interval.tv_usec = 100000;  // 100ms
-    
-    // 잠시 대기하여 자식 프로세스들이 초기화되도록 함
-    usleep(50000);
-    
-    // 스케줄링 시작
-    schedule_next_process();
-    
-    // 타이머 시작
-    setitimer(ITIMER_REAL, &timer, NULL);
-    
-    // 모든 자식 프로세스 완료 대기
-    while (completed_processes < num_processes) {
-        pause();
+    if (config.max_burst < 1) {
+        fprintf(stderr, "최대 CPU 버스트는 1 이상이어야 합니다.\n");
+        exit(1);
     }
-    
-    // 타이머 정지
-    timer.it_value.tv_sec = 0;
-    timer.it_value.tv_usec = 0;
-    timer.it_interval.tv_sec = 0;
-    timer.it_interval.tv_usec = 0;
-    setitimer(ITIMER_REAL, &timer, NULL);
-    
-    // 간트 차트 출력
-    print_gantt_chart();
-    
-    // 통계 계산 및 출력
-    calculate_statistics();
-    
-    return 0;
-}
-
-void initialize_pcb(int index, pid_t pid, int cpu_burst) {
-    pcb_table[index].pid = pid;
-    pcb_table[index].remaining_quantum = time_quantum;
-    pcb_table[index].cpu_burst = cpu_burst;  // 전달받은 값 사용
-    pcb_table[index].io_wait_time = 0;
-    pcb_table[index].state = READY;
-    pcb_table[index].wait_time = 0;
-    pcb_table[index].start_time = current_time;  // 도착 시간 (프로세스 생성 시점)
-    pcb_table[index].completion_time = -1;
-}
-
-int find_process_by_pid(pid_t pid) {
-    for (int i = 0; i < num_processes; i++) {
-        if (pcb_table[i].pid == pid) {
-            return i;
-        }
+    if (rt_utilization < 0 || (rt_utilization > 0 && read_stdin)) {
+        fprintf(stderr, "실시간 태스크 사용률은 0보다 커야 하고 -i와 함께 쓸 수 없습니다.\n");
+        exit(1);
     }
-    return -1;
-}
-
-void parent_child_handler(int sig) {
-    int status;
-    pid_t pid;
-    
-    // 모든 종료된 자식 프로세스 처리
-    while ((pid = waitpid(-1, &status, WNOHANG)) > 0) {
-        int index = find_process_by_pid(pid);
-        if (index != -1) {
-            // 아직 DONE 처리 안 된 경우만 카운트
-            if (pcb_table[index].state != DONE) {
-                pcb_table[index].state = DONE;
-                pcb_table[index].completion_time = current_time;
-                completed_processes++;
-                printf("[시간:%d][프로세스 %d] 종료됨. 완료: %d/%d\n", 
-                       current_time, index, completed_processes, num_processes);
-            }
-            
-            // 현재 실행 중인 프로세스가 종료되었으면 다음 프로세스 스케줄
-            if (current_process == index) {
-                current_process = -1;
-            }
-            // 다음 프로세스 스케줄 (SIGCHLD에서)
-            if (current_process == -1) {
-                schedule_next_process();
-            }
-        }
+    if (config.rt_horizon < 1) {
+        fprintf(stderr, "릴리스 기간은 1 이상이어야 합니다.\n");
+        exit(1);
     }
-}
-
-void parent_timer_handler(int sig) {
-    current_time++;
-    update_wait_times();
-    
-    // 10초마다 구분선 출력
-    if (current_time % 10 == 0) {
-        printf("────────────────────────────── [%d초] ──────────────────────────────\n", current_time);
+    if (config.aging_interval < 1 || config.aging_amount < 0) {
+        fprintf(stderr, "에이징 간격은 1 이상, 증가량은 0 이상이어야 합니다.\n");
+        exit(1);
     }
-    
-    // I/O 대기 시간 먼저 확인
-    for (int i = 0; i < num_processes; i++) {
-        if (pcb_table[i].state == SLEEP) {
-            pcb_table[i].io_wait_time--;
-            if (pcb_table[i].io_wait_time <= 0) {
-                printf("[시간:%d][프로세스 %d] I/O 완료, READY로 이동\n", current_time, i);
-                pcb_table[i].state = READY;
-                // I/O 완료 시 타임퀀텀은 0으로 유지 - 전체 리셋 로직에서 처리
-            }
-        }
+    if (config.num_cpus < 1 || config.num_cpus > MAX_CPUS) {
+        fprintf(stderr, "CPU 수는 1-%d 사이여야 합니다.\n", MAX_CPUS);
+        exit(1);
     }
-    
-    if (current_process != -1) {
-        PCB *current_pcb = &pcb_table[current_process];
-        
-        if (current_pcb->state == RUNNING) {
-            // 자식에게 시그널 보내서 CPU 버스트 실행
-            kill(current_pcb->pid, SIGUSR1);
-            
-            // 부모측에서 CPU 버스트 감소
-            current_pcb->cpu_burst--;
-            
-            // 타임 퀀텀 감소
-            current_pcb->remaining_quantum--;
-            
-            // CPU 버스트가 0이 되면 프로세스 종료 또는 I/O
-            if (current_pcb->cpu_burst <= 0) {
-                if (rand() % 2 == 0) {
-                    // 프로세스 종료 요청
-                    printf("[시간:%d][프로세스 %d] CPU 버스트 완료, 종료 중\n", current_time, current_process);
-                    // 바로 DONE 상태로 설정 (간트 차트에 READY로 표시되지 않도록)
-                    current_pcb->state = DONE;
-                    current_pcb->completion_time = current_time;
-                    completed_processes++;
-                    printf("[시간:%d][프로세스 %d] 종료됨. 완료: %d/%d\n", 
-                           current_time, current_process, completed_processes, num_processes);
-                    // SIGTERM을 보내서 자식 종료 유도
-                    kill(current_pcb->pid, SIGTERM);
-                    current_process = -1;
-                    schedule_next_process();
-                } else {
-                    // I/O 요청
-                    int io_time = (rand() % MAX_IO_TIME) + 1;
-                    printf("[시간:%d][프로세스 %d] CPU 버스트 완료, I/O 요청 (대기: %d)\n", 
-                           current_time, current_process, io_time);
-                    current_pcb->io_wait_time = io_time;
-                    current_pcb->state = SLEEP;
-                    current_pcb->cpu_burst = (rand() % MAX_CPU_BURST) + 1;
-                    current_process = -1;
-                    schedule_next_process();
-                }
-            }
-            // 타임 퀀텀 만료 확인
-            else if (current_pcb->remaining_quantum <= 0) {
-                printf("[시간:%d][프로세스 %d] 타임 퀀텀 만료\n", current_time, current_process);
-                current_pcb->state = READY;
-                // 개별 리셋 제거 - 전체 리셋 로직에서 처리 (schedule_next_process에서)
-                current_process = -1;
-                schedule_next_process();
-            }
-        }
-    } else {
-        // 현재 실행 중인 프로세스가 없으면 스케줄링 시도
-        schedule_next_process();
+    if (config.migration_penalty < 0) {
+        fprintf(stderr, "이주 비용은 0 이상이어야 합니다.\n");
+        exit(1);
+    }
+    if (config.job_path != NULL && (!config.virtual_mode || read_stdin || rt_utilization > 0)) {
+        fprintf(stderr, "작업 트레이스(-w)는 가상 시간 모드(-v)에서만 쓸 수 있고 -i/-R과 함께 쓸 수 없습니다.\n");
+        exit(1);
+    }
+    if (config.arrival_rate < 0 || (config.arrival_rate > 0 &&
+        (!config.virtual_mode || read_stdin || rt_utilization > 0 || config.job_path != NULL))) {
+        fprintf(stderr, "포아송 도착률(-O)은 0보다 커야 하고 가상 시간 모드(-v)에서만, -i/-R/-w 없이 쓸 수 있습니다.\n");
+        exit(1);
+    }
+    if (config.report_interval < 0) {
+        fprintf(stderr, "구간 보고 간격은 0 이상이어야 합니다.\n");
+        exit(1);
+    }
+    if (config.real_exec && config.virtual_mode) {
+        fprintf(stderr, "실제 실행(-x)은 실시간 틱 모드에서만 쓸 수 있습니다 (-v 없이).\n");
+        exit(1);
     }
-    
-    // 간트 차트에 모든 프로세스 상태 기록 (모든 상태 변경 후에 기록)
-    if (current_time < MAX_TIME) {
-        for (int p = 0; p < num_processes; p++) {
-            switch (pcb_table[p].state) {
-                case READY:   gantt_chart[p][current_time] = 1; break;
-                case RUNNING: gantt_chart[p][current_time] = 2; break;
-                case SLEEP:   gantt_chart[p][current_time] = 3; break;
-                default:      gantt_chart[p][current_time] = 0; break;
+    if (config.latency_path != NULL && config.virtual_mode) {
+        fprintf(stderr, "지연 히스토그램(-L)은 실시간 틱 모드에서만 쓸 수 있습니다 (-v 없이).\n");
+        exit(1);
+    }
+    if (config.control == CONTROL_FUTEX && (config.virtual_mode || config.real_exec)) {
+        fprintf(stderr, "futex 제어(-K futex)는 실시간 틱 모드에서만, -x 없이 쓸 수 있습니다.\n");
+        exit(1);
+    }
+    if (config.spin < 0) {
+        fprintf(stderr, "잠들기 전 확인 횟수는 0 이상이어야 합니다.\n");
+        exit(1);
+    }
+    if (log_level < -1 || log_level > LOG_DETAIL) {
+        fprintf(stderr, "이벤트 로그 수준은 0-%d 사이여야 합니다.\n", LOG_DETAIL);
+        exit(1);
+    }
+    if (config.tick_us < MIN_TICK_US) {
+        fprintf(stderr, "틱 간격은 %d마이크로초 이상이어야 합니다.\n", MIN_TICK_US);
+        exit(1);
+    }
+    if (config.time_scale < 1) {
+        fprintf(stderr, "트레이스 시간 단위는 1 이상이어야 합니다.\n");
+        exit(1);
+    }
+    num_selected = parse_policies(policy_list, selected);
+    for (int k = 0; k < num_selected && config.num_cpus > 1; k++) {
+        if (selected[k]->steal == NULL) {
+            fprintf(stderr, "%s 정책은 단일 CPU 전용입니다 (다중 CPU 지원:", selected[k]->name);
+            for (int j = 0; j < num_registered_policies; j++) {
+                if (registered_policies[j]->steal != NULL) {
+                    fprintf(stderr, " %s", registered_policies[j]->name);
+                }
             }
+            fprintf(stderr, ").\n");
+            exit(1);
         }
     }
-}
-
-void child_signal_handler(int sig) {
-    if (sig == SIGTERM) {
-        child_should_exit = 1;
-    }
-    // SIGUSR1은 단순히 "실행 중"임을 나타내는 용도로만 사용
-}
 
-int find_next_ready_process() {
-    // 라운드 로빈: last_scheduled 다음부터 READY이면서 타임퀀텀이 남은 프로세스 찾기
-    int start = (last_scheduled + 1) % num_processes;
-    
-    for (int i = 0; i < num_processes; i++) {
-        int index = (start + i) % num_processes;
-        // READY 상태이면서 타임퀀텀이 남아있는 프로세스만 선택
-        if (pcb_table[index].state == READY && pcb_table[index].remaining_quantum > 0) {
-            return index;
-        }
+    // 여러 정책을 비교할 때는 이벤트 로그를 생략하고 간트 차트/통계/비교표만 출력 (-V로 직접 정하지 않았으면)
+    if (log_level != -1) {
+        config.verbose = log_level;
+    } else {
+        config.verbose = num_selected == 1 || force_log ? LOG_DETAIL : LOG_QUIET;
     }
-    
-    return -1;  // 타임퀀텀이 남은 READY 프로세스 없음
-}
 
-void schedule_next_process() {
-    int next = find_next_ready_process();
-    
-    // 타임퀀텀이 남은 READY 프로세스가 없으면 전체 리셋 시도
-    if (next == -1) {
-        // READY 상태인 프로세스가 있는지 확인 (타임퀀텀은 0이지만)
-        int has_ready = 0;
-        for (int i = 0; i < num_processes; i++) {
-            if (pcb_table[i].state == READY) {
-                has_ready = 1;
-                break;
-            }
+    printf("\n=== OS 스케줄링 시뮬레이션 ===\n");
+    if (config.job_path != NULL) {
+        size_t len = strlen(config.job_path);
+        if (len >= 4 && strcmp(config.job_path + len - 4, ".swf") == 0) {
+            printf("작업 트레이스: %s (SWF, 1틱 = %d초)\n", config.job_path, config.time_scale);
+        } else {
+            printf("작업 트레이스: %s\n", config.job_path);
         }
-        
-        if (has_ready) {
-            printf("[시간:%d] 모든 프로세스 타임퀀텀 소진 → 전체 타임퀀텀 초기화\n", current_time);
-            reset_all_quantum();
-            next = find_next_ready_process();  // 리셋 후 다시 찾기
+    } else if (config.arrival_rate > 0) {
+        printf("포아송 도착: 틱당 %.4f개 (평균 간격 %.1f틱), 작업 ", config.arrival_rate, 1.0 / config.arrival_rate);
+        if (config.num_processes > 0) {
+            printf("%d개\n", config.num_processes);
+        } else {
+            printf("무제한 (중단할 때까지)\n");
         }
+    } else {
+        printf("프로세스 수: %d\n", config.num_processes);
+    }
+    printf("정책: ");
+    for (int k = 0; k < num_selected; k++) {
+        printf("%s%s", k > 0 ? ", " : "", selected[k]->title);
+    }
+    printf("\n");
+    printf("타임 퀀텀: %d\n", config.time_quantum);
+    if (config.num_cpus > 1) {
+        printf("CPU: %d개 (이주 비용 %d틱, 부하 분산 주기 %d틱)\n",
+               config.num_cpus, config.migration_penalty, BALANCE_INTERVAL);
     }
-    
-    if (next != -1) {
-        current_process = next;
-        last_scheduled = next;  // 라운드 로빈을 위해 마지막 스케줄 기록
-        pcb_table[current_process].state = RUNNING;
-        
-        printf("[시간:%d][프로세스 %d] 스케줄링 (남은 퀀텀: %d)\n", 
-               current_time, current_process, pcb_table[current_process].remaining_quantum);
+    if (config.virtual_mode) {
+        printf("시드: %u (가상 시간 모드)\n", config.seed);
     } else {
-        current_process = -1;
+        printf("시드: %u (실시간 틱 모드, 틱 %.1fms, %s)\n", config.seed, config.tick_us / 1000.0,
+               config.real_exec ? "실제 실행" : config.control == CONTROL_FUTEX ? "futex 제어" : "시그널 제어");
     }
-}
-
-void update_wait_times() {
-    for (int i = 0; i < num_processes; i++) {
-        if (pcb_table[i].state == READY) {
-            pcb_table[i].wait_time++;
-        }
+    if (rt_utilization > 0) {
+        printf("실시간 태스크: 목표 사용률 %.2f, 릴리스 기간 %d\n", rt_utilization, config.rt_horizon);
     }
-}
+    printf("===============================\n\n");
 
-void print_status() {
-    printf("\n--- 시스템 상태 (시간: %d) ---\n", current_time);
-    printf("프로세스\t상태\t\t퀀텀\tCPU 버스트\tI/O 대기\t대기 시간\n");
-    printf("--------------------------------------------------------------------\n");
-    
-    for (int i = 0; i < num_processes; i++) {
-        const char *state_str;
-        switch (pcb_table[i].state) {
-            case READY: state_str = "READY"; break;
-            case RUNNING: state_str = "RUNNING"; break;
-            case SLEEP: state_str = "SLEEP"; break;
-            case DONE: state_str = "DONE"; break;
-            default: state_str = "UNKNOWN";
-        }
-        
-        printf("%d\t%s\t\t%d\t%d\t\t%d\t\t%d\n",
-               i, state_str, 
-               pcb_table[i].remaining_quantum,
-               pcb_table[i].cpu_burst,
-               pcb_table[i].io_wait_time,
-               pcb_table[i].wait_time);
+    // 모든 정책이 같은 작업 부하로 실행 (이후 버스트/I/O도 프로세스별 난수열이라 정책과 무관)
+    Workload workload;
+    if (config.job_path != NULL || config.arrival_rate > 0) {
+        memset(&workload, 0, sizeof(workload));     // 열린 시스템: 프로세스는 도착할 때 생성
+    } else if (rt_utilization > 0) {
+        make_rt_workload(&workload, &config, rt_utilization);
+    } else {
+        make_workload(&workload, &config, read_stdin);
     }
-    printf("완료: %d/%d\n\n", completed_processes, num_processes);
-}
 
-void calculate_statistics() {
-    printf("\n=== 최종 통계 ===\n");
-    printf("사용된 타임 퀀텀: %d\n", time_quantum);
-    printf("총 시뮬레이션 시간: %d\n", current_time);
-    
-    int total_wait_time = 0;
-    int total_turnaround_time = 0;
-    int process_count = 0;
-    
-    for (int i = 0; i < num_processes; i++) {
-        if (pcb_table[i].state == DONE && pcb_table[i].completion_time != -1) {
-            int turnaround = pcb_table[i].completion_time - pcb_table[i].start_time;
-            total_wait_time += pcb_table[i].wait_time;
-            total_turnaround_time += turnaround;
-            process_count++;
-            printf("프로세스 %d - 대기 시간: %d, 턴어라운드: %d\n", 
-                   i, pcb_table[i].wait_time, turnaround);
+    SimResult results[MAX_POLICIES];
+    char trace_path[4096], latency_path[4096];
+    const char *base_trace = config.trace_path;
+    const char *base_latency = config.latency_path;
+
+    for (int k = 0; k < num_selected; k++) {
+        Sim sim;
+
+        // 정책이 여럿이면 트레이스/히스토그램 파일을 정책별로 나눔 (파일.정책이름)
+        if (base_trace != NULL && num_selected > 1) {
+            snprintf(trace_path, sizeof(trace_path), "%s.%s", base_trace, selected[k]->name);
+            config.trace_path = trace_path;
         }
+        if (base_latency != NULL && num_selected > 1) {
+            snprintf(latency_path, sizeof(latency_path), "%s.%s", base_latency, selected[k]->name);
+            config.latency_path = latency_path;
+        }
+        if (num_selected > 1) {
+            printf("\n##### [%s] #####\n", selected[k]->title);
+        }
+
+        sim_init(&sim, selected[k], &config);
+        sim_run(&sim, &workload);
+        sim_print_gantt_chart(&sim);
+        sim_print_statistics(&sim);
+        sim_summarize(&sim, &results[k]);
+        sim_free(&sim);
     }
-    
-    if (process_count > 0) {
-        double avg_wait_time = (double)total_wait_time / process_count;
-        double avg_turnaround = (double)total_turnaround_time / process_count;
-        printf("\n평균 대기 시간: %.2f time units\n", avg_wait_time);
-        printf("평균 턴어라운드 시간: %.2f time units\n", avg_turnaround);
-    }
-    
-    printf("=================\n");
-}
 
-void reset_all_quantum() {
-    for (int i = 0; i < num_processes; i++) {
-        if (pcb_table[i].state != DONE) {
-            pcb_table[i].remaining_quantum = time_quantum;
+    if (num_selected > 1) {
+        printf("\n=== 정책 비교 (같은 작업 부하) ===\n");
+        printf("정책        총 시간   평균 대기   평균 턴어라운드   평균 응답   I/O 복귀 응답   디스패치%s\n",
+               workload.period != NULL ? "   데드라인 미스" : "");
+        for (int k = 0; k < num_selected; k++) {
+            printf("%-10s %8d %11.2f %17.2f %11.2f %15.2f %10d", selected[k]->name, results[k].total_time,
+                   results[k].avg_wait_time, results[k].avg_turnaround, results[k].avg_response,
+                   results[k].avg_io_response, results[k].dispatches);
+            if (workload.period != NULL) {
+                printf(" %9d/%d", results[k].deadline_misses, results[k].jobs);
+            }
+            printf("\n");
         }
     }
+
+    free_workload(&workload);
+    return 0;
 }
 
-void print_gantt_chart() {
-    printf("\n=== 간트 차트 ===\n\n");
-    
-    int total_time = current_time;
-    if (total_time > MAX_TIME) total_time = MAX_TIME;
-    if (total_time > 150) total_time = 150;  // 화면에 맞게 최대 150칸
-    
-    // 시간 헤더
-    printf("시간: ");
-    for (int t = 0; t <= total_time; t += 10) {
-        printf("%-10d", t);
-    }
-    printf("\n");
-    
-    // 눈금자
-    printf("      ");
-    for (int t = 1; t <= total_time; t++) {
-        if (t % 10 == 0) {
-            printf("|");
-        } else if (t % 5 == 0) {
-            printf("+");
-        } else {
-            printf("-");
-        }
-    }
-    printf("\n");
-    
-    // 각 프로세스별 타임라인
-    for (int p = 0; p < num_processes; p++) {
-        printf("P%-4d ", p);
-        for (int t = 1; t <= total_time; t++) {
-            switch (gantt_chart[p][t]) {
-                case 1:  printf("·"); break;  // READY
-                case 2:  printf("█"); break;  // RUNNING
-                case 3:  printf("░"); break;  // SLEEP
-                default: printf(" "); break;  // DONE 또는 시작 전
-            }
-        }
-        printf("\n");
+static void print_usage(const char *prog) {
+    fprintf(stderr, "사용법: %s [-p 정책[,정책...]|all] [-q 타임 퀀텀] [-b 최대 CPU 버스트] [-i] [-e] [-v] [-s 시드] "
+                    "[-n 프로세스 수] [-g 시작[:끝]] [-t 트레이스 파일] [-R 실시간 사용률] [-H 릴리스 기간] "
+                    "[-c CPU 수] [-m 이주 비용] [-a 에이징 간격] [-A 에이징 증가량] [-w 작업 트레이스] [-T 초/틱] "
+                    "[-O 포아송 도착률] [-r 보고 간격] [-x] [-u 틱 간격(us)] [-L 지연 히스토그램] [-K signal|futex] [-S 확인 횟수] [-P fork|spawn] [-V 로그 수준]\n", prog);
+    fprintf(stderr, "작업 트레이스: 한 줄에 '도착 우선순위 CPU [I/O CPU]...' 또는 .swf (Standard Workload Format)\n");
+    fprintf(stderr, "정책:");
+    for (int k = 0; k < num_registered_policies; k++) {
+        fprintf(stderr, " %s", registered_policies[k]->name);
     }
-    
-    // 범례
-    printf("\n범례:  █ = RUNNING   ░ = SLEEP   · = READY\n");
-}
\ No newline at end of file
+    fprintf(stderr, "\n");
+}
@@ -0,0 +1,83 @@
+#ifndef SPSC_RING_H
+#define SPSC_RING_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdatomic.h>
+
+// 락 없는 고정 크기 레코드 링 버퍼 (생산자 1, 소비자 1)
+// 틱 처리(생산자)는 칸을 잡아 채우고 공개하기만 하고, 메인 루프(소비자)가 ring_drain으로 레코드마다 drain을 호출
+// 지금은 둘 다 같은 epoll 스레드에서 돌지만 head/tail을 원자적으로 두어 소비자를 다른 스레드로 옮겨도 그대로 동작
+// 링이 가득 차면: sync = 1이면 생산자가 직접 비우고 (가상 시간 모드, 누락 없음),
+// 아니면 버리고 개수만 셈 (실시간 틱 모드, 틱 처리 비용이 소비 속도와 무관)
+typedef void (*RingDrain)(void *ctx, const void *record);
+
+typedef struct {
+    char *slots;
+    size_t record_size;
+    unsigned int capacity;  // 2의 거듭제곱
+    atomic_uint head;       // 생산자만 증가
+    atomic_uint tail;       // 소비자만 증가
+    unsigned long dropped;
+    int sync;
+    RingDrain drain;
+    void *ctx;
+} SpscRing;
+
+static inline void ring_open(SpscRing *r, size_t record_size, unsigned int capacity, int sync,
+                             RingDrain drain, void *ctx) {
+    r->slots = malloc(record_size * capacity);
+    if (r->slots == NULL) {
+        perror("링 버퍼 할당 실패");
+        exit(1);
+    }
+    r->record_size = record_size;
+    r->capacity = capacity;
+    atomic_init(&r->head, 0);
+    atomic_init(&r->tail, 0);
+    r->dropped = 0;
+    r->sync = sync;
+    r->drain = drain;
+    r->ctx = ctx;
+}
+
+// 쌓인 레코드를 순서대로 drain에 넘김 (소비자)
+static inline void ring_drain(SpscRing *r) {
+    unsigned int tail = atomic_load_explicit(&r->tail, memory_order_relaxed);
+    unsigned int head = atomic_load_explicit(&r->head, memory_order_acquire);
+
+    for (unsigned int i = tail; i != head; i++) {
+        r->drain(r->ctx, r->slots + (size_t)(i & (r->capacity - 1)) * r->record_size);
+    }
+    atomic_store_explicit(&r->tail, head, memory_order_release);
+}
+
+// 다음 칸 (가득 차서 버렸으면 NULL), 채운 뒤 ring_commit으로 공개 (생산자)
+static inline void *ring_reserve(SpscRing *r) {
+    unsigned int head = atomic_load_explicit(&r->head, memory_order_relaxed);
+    unsigned int tail = atomic_load_explicit(&r->tail, memory_order_acquire);
+
+    if (head - tail == r->capacity) {
+        if (!r->sync) {
+            r->dropped++;
+            return NULL;
+        }
+        ring_drain(r);
+    }
+    return r->slots + (size_t)(head & (r->capacity - 1)) * r->record_size;
+}
+
+static inline void ring_commit(SpscRing *r) {
+    unsigned int head = atomic_load_explicit(&r->head, memory_order_relaxed);
+
+    atomic_store_explicit(&r->head, head + 1, memory_order_release);
+}
+
+// 남은 레코드를 비우고 해제
+static inline void ring_close(SpscRing *r) {
+    ring_drain(r);
+    free(r->slots);
+    r->slots = NULL;
+}
+
+#endif
@@ -0,0 +1,333 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+
+#include "sched_setup.h"
+
+// 파라미터 스윕: 정책 × 프로세스 수 × 타임 퀀텀 × 에이징 간격 × 에이징 증가량 × 시드의 모든 조합을
+// 가상 시간 모드로 실행하고 실행마다 CSV 한 줄 (또는 JSON 객체 한 줄)을 출력
+// - 실행별 상태는 모두 Sim 안에 있고 난수도 프로세스별 rand_r이라 가상 시간 시뮬레이션끼리는 공유 상태가 없음
+//   → 스레드 풀의 작업자들이 다음 조합 번호를 원자적으로 하나씩 가져가 독립적으로 실행
+// - 조합 번호는 혼합 진법으로 파라미터에 대응 (시드가 가장 빨리 바뀜), 결과는 번호 순으로 출력해 재현 가능
+#define MAX_SWEEP_RUNS 10000000     // 결과를 모두 메모리에 모았다가 출력하므로 조합 수 상한
+
+// 스윕 파라미터 (조합 번호의 자릿수 순서, 앞이 가장 느리게 바뀜)
+enum {
+    PARAM_PROCESSES,
+    PARAM_QUANTUM,
+    PARAM_AGING_INTERVAL,
+    PARAM_AGING_AMOUNT,
+    PARAM_SEED,
+    NUM_PARAMS
+};
+
+// 시작:끝:간격 (끝 포함)
+typedef struct {
+    long long from;
+    long long to;
+    long long step;
+} Range;
+
+typedef struct {
+    const Policy *policy;
+    long long params[NUM_PARAMS];
+    SimResult result;
+    double elapsed_ms;      // 이 실행의 시뮬레이션 시간 (벽시계)
+} SweepRun;
+
+typedef struct {
+    const Policy **policies;
+    int num_policies;
+    Range ranges[NUM_PARAMS];
+    long long counts[NUM_PARAMS];
+    SimConfig base;
+    SweepRun *runs;
+    long long total;
+    long long next;         // 다음에 가져갈 조합 번호 (작업자들이 원자적으로 증가)
+} Sweep;
+
+static const char *param_names[NUM_PARAMS] = {
+    "processes", "quantum", "aging_interval", "aging_amount", "seed"
+};
+
+// 함수 원형
+static void parse_range(const char *text, Range *range, const char *what, long long min, long long max);
+static long long range_count(const Range *range);
+static void decode_run(const Sweep *sweep, long long job, SweepRun *run);
+static void execute_run(const Sweep *sweep, SweepRun *run);
+static void *worker(void *arg);
+static void print_csv(const Sweep *sweep, FILE *out);
+static void print_json(const Sweep *sweep, FILE *out);
+static void print_best(const Sweep *sweep);
+static double elapsed_ms(const struct timespec *begin, const struct timespec *end);
+static void print_usage(const char *prog);
+
+int main(int argc, char *argv[]) {
+    Sweep sweep;
+    const Policy *selected[MAX_POLICIES];
+    char default_policy[] = "rr,priority";
+    char *policy_list = default_policy;
+    const char *format = "csv";
+    const char *output_path = NULL;
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    int num_threads = cpus > 0 ? (int)cpus : 1;
+    int opt;
+
+    memset(&sweep, 0, sizeof(sweep));
+    sim_default_config(&sweep.base);
+    sweep.base.virtual_mode = 1;
+    sweep.base.verbose = 0;
+    sweep.ranges[PARAM_PROCESSES] = (Range){DEFAULT_PROCESSES, DEFAULT_PROCESSES, 1};
+    sweep.ranges[PARAM_QUANTUM] = (Range){sweep.base.time_quantum, sweep.base.time_quantum, 1};
+    sweep.ranges[PARAM_AGING_INTERVAL] = (Range){DEFAULT_AGING_INTERVAL, DEFAULT_AGING_INTERVAL, 1};
+    sweep.ranges[PARAM_AGING_AMOUNT] = (Range){DEFAULT_AGING_AMOUNT, DEFAULT_AGING_AMOUNT, 1};
+    sweep.ranges[PARAM_SEED] = (Range){1, 1, 1};
+
+    // 명령행 옵션: -p 정책 목록, 범위(시작[:끝[:간격]]) -n 프로세스 수, -q 타임 퀀텀, -a 에이징 간격,
+    // -A 에이징 증가량, -s 시드, 고정값 -b 최대 CPU 버스트, -j 스레드 수, -f csv|json, -o 출력 파일
+    while ((opt = getopt(argc, argv, "p:n:q:a:A:s:b:j:f:o:")) != -1) {
+        switch (opt) {
+            case 'p': policy_list = optarg; break;
+            case 'n': parse_range(optarg, &sweep.ranges[PARAM_PROCESSES], "프로세스 수", 1, 1000000000); break;
+            case 'q': parse_range(optarg, &sweep.ranges[PARAM_QUANTUM], "타임 퀀텀", 1, MAX_TIME_QUANTUM); break;
+            case 'a': parse_range(optarg, &sweep.ranges[PARAM_AGING_INTERVAL], "에이징 간격", 1, 1000000); break;
+            case 'A': parse_range(optarg, &sweep.ranges[PARAM_AGING_AMOUNT], "에이징 증가량", 0, MAX_PRIORITY); break;
+            case 's': parse_range(optarg, &sweep.ranges[PARAM_SEED], "시드", 0, 4294967295LL); break;
+            case 'b': sweep.base.max_burst = atoi(optarg); break;
+            case 'j': num_threads = atoi(optarg); break;
+            case 'f': format = optarg; break;
+            case 'o': output_path = optarg; break;
+            default:
+                print_usage(argv[0]);
+                exit(1);
+        }
+    }
+    if (sweep.base.max_burst < 1) {
+        fprintf(stderr, "최대 CPU 버스트는 1 이상이어야 합니다.\n");
+        exit(1);
+    }
+    if (num_threads < 1) {
+        fprintf(stderr, "스레드 수는 1 이상이어야 합니다.\n");
+        exit(1);
+    }
+    if (strcmp(format, "csv") != 0 && strcmp(format, "json") != 0) {
+        fprintf(stderr, "출력 형식은 csv 또는 json이어야 합니다.\n");
+        exit(1);
+    }
+    sweep.num_policies = parse_policies(policy_list, selected);
+    sweep.policies = selected;
+
+    // 조합 수 = 정책 수 × 파라미터별 값 개수의 곱
+    sweep.total = sweep.num_policies;
+    for (int k = 0; k < NUM_PARAMS; k++) {
+        sweep.counts[k] = range_count(&sweep.ranges[k]);
+        if (sweep.total > MAX_SWEEP_RUNS / sweep.counts[k]) {
+            fprintf(stderr, "조합이 너무 많습니다 (최대 %d개).\n", MAX_SWEEP_RUNS);
+            exit(1);
+        }
+        sweep.total *= sweep.counts[k];
+    }
+    sweep.runs = calloc(sweep.total, sizeof(SweepRun));
+    if (sweep.runs == NULL) {
+        perror("결과 배열 할당 실패");
+        exit(1);
+    }
+    if (num_threads > sweep.total) {
+        num_threads = (int)sweep.total;
+    }
+
+    FILE *out = stdout;
+    if (output_path != NULL) {
+        out = fopen(output_path, "w");
+        if (out == NULL) {
+            perror("출력 파일 열기 실패");
+            exit(1);
+        }
+    }
+
+    struct timespec begin, end;
+    pthread_t *threads = malloc(sizeof(pthread_t) * num_threads);
+    if (threads == NULL) {
+        perror("스레드 배열 할당 실패");
+        exit(1);
+    }
+    clock_gettime(CLOCK_MONOTONIC, &begin);
+    for (int t = 0; t < num_threads; t++) {
+        if (pthread_create(&threads[t], NULL, worker, &sweep) != 0) {
+            fprintf(stderr, "스레드 생성 실패\n");
+            exit(1);
+        }
+    }
+    for (int t = 0; t < num_threads; t++) {
+        pthread_join(threads[t], NULL);
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    free(threads);
+
+    if (strcmp(format, "csv") == 0) {
+        print_csv(&sweep, out);
+    } else {
+        print_json(&sweep, out);
+    }
+    if (out != stdout) {
+        fclose(out);
+    }
+
+    double wall_ms = elapsed_ms(&begin, &end);
+    fprintf(stderr, "[스윕] 실행 %lld회, 스레드 %d개: %.1f ms (%.0f 실행/초)\n",
+            sweep.total, num_threads, wall_ms, wall_ms > 0 ? sweep.total / (wall_ms / 1e3) : 0.0);
+    print_best(&sweep);
+
+    free(sweep.runs);
+    return 0;
+}
+
+// 시작[:끝[:간격]] (끝 생략 = 시작 하나, 간격 생략 = 1)
+static void parse_range(const char *text, Range *range, const char *what, long long min, long long max) {
+    Range r = {0, 0, 1};
+    int fields = sscanf(text, "%lld:%lld:%lld", &r.from, &r.to, &r.step);
+
+    if (fields < 1) {
+        fprintf(stderr, "%s 범위는 시작[:끝[:간격]] 형식이어야 합니다.\n", what);
+        exit(1);
+    }
+    if (fields == 1) {
+        r.to = r.from;
+    }
+    if (r.from < min || r.to > max || r.from > r.to || r.step < 1) {
+        fprintf(stderr, "%s 범위는 %lld-%lld 사이, 시작 <= 끝, 간격 >= 1이어야 합니다.\n", what, min, max);
+        exit(1);
+    }
+    *range = r;
+}
+
+static long long range_count(const Range *range) {
+    return (range->to - range->from) / range->step + 1;
+}
+
+// 조합 번호 → 정책과 파라미터 값 (마지막 파라미터가 가장 낮은 자리)
+static void decode_run(const Sweep *sweep, long long job, SweepRun *run) {
+    for (int k = NUM_PARAMS - 1; k >= 0; k--) {
+        run->params[k] = sweep->ranges[k].from + (job % sweep->counts[k]) * sweep->ranges[k].step;
+        job /= sweep->counts[k];
+    }
+    run->policy = sweep->policies[job];
+}
+
+static void execute_run(const Sweep *sweep, SweepRun *run) {
+    SimConfig config = sweep->base;
+    Workload workload;
+    Sim sim;
+    struct timespec begin, end;
+
+    config.num_processes = (int)run->params[PARAM_PROCESSES];
+    config.time_quantum = (int)run->params[PARAM_QUANTUM];
+    config.aging_interval = (int)run->params[PARAM_AGING_INTERVAL];
+    config.aging_amount = (int)run->params[PARAM_AGING_AMOUNT];
+    config.seed = (unsigned int)run->params[PARAM_SEED];
+
+    clock_gettime(CLOCK_MONOTONIC, &begin);
+    make_workload(&workload, &config, 0);
+    sim_init(&sim, run->policy, &config);
+    sim_run(&sim, &workload);
+    sim_summarize(&sim, &run->result);
+    sim_free(&sim);
+    free_workload(&workload);
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    run->elapsed_ms = elapsed_ms(&begin, &end);
+}
+
+// 작업자: 남은 조합이 없을 때까지 다음 번호를 가져와 실행 (결과는 번호 자리에 기록하므로 잠금 불필요)
+static void *worker(void *arg) {
+    Sweep *sweep = arg;
+
+    while (1) {
+        long long job = __atomic_fetch_add(&sweep->next, 1, __ATOMIC_RELAXED);
+        if (job >= sweep->total) {
+            break;
+        }
+        decode_run(sweep, job, &sweep->runs[job]);
+        execute_run(sweep, &sweep->runs[job]);
+    }
+    return NULL;
+}
+
+static void print_csv(const Sweep *sweep, FILE *out) {
+    fprintf(out, "policy");
+    for (int k = 0; k < NUM_PARAMS; k++) {
+        fprintf(out, ",%s", param_names[k]);
+    }
+    fprintf(out, ",total_time,completed,avg_wait,avg_turnaround,avg_response,avg_io_response,dispatches,sim_ms\n");
+    for (long long j = 0; j < sweep->total; j++) {
+        const SweepRun *run = &sweep->runs[j];
+        fprintf(out, "%s", run->policy->name);
+        for (int k = 0; k < NUM_PARAMS; k++) {
+            fprintf(out, ",%lld", run->params[k]);
+        }
+        fprintf(out, ",%d,%d,%.4f,%.4f,%.4f,%.4f,%d,%.3f\n",
+                run->result.total_time, run->result.completed, run->result.avg_wait_time,
+                run->result.avg_turnaround, run->result.avg_response, run->result.avg_io_response,
+                run->result.dispatches, run->elapsed_ms);
+    }
+}
+
+// JSON Lines: 실행마다 객체 한 줄 (스트리밍 도구가 줄 단위로 읽을 수 있음)
+static void print_json(const Sweep *sweep, FILE *out) {
+    for (long long j = 0; j < sweep->total; j++) {
+        const SweepRun *run = &sweep->runs[j];
+        fprintf(out, "{\"policy\":\"%s\"", run->policy->name);
+        for (int k = 0; k < NUM_PARAMS; k++) {
+            fprintf(out, ",\"%s\":%lld", param_names[k], run->params[k]);
+        }
+        fprintf(out, ",\"total_time\":%d,\"completed\":%d,\"avg_wait\":%.4f,\"avg_turnaround\":%.4f,"
+                "\"avg_response\":%.4f,\"avg_io_response\":%.4f,\"dispatches\":%d,\"sim_ms\":%.3f}\n",
+                run->result.total_time, run->result.completed, run->result.avg_wait_time,
+                run->result.avg_turnaround, run->result.avg_response, run->result.avg_io_response,
+                run->result.dispatches, run->elapsed_ms);
+    }
+}
+
+// 정책별로 시드 평균 대기 시간이 가장 짧은 파라미터 조합 (시드를 제외한 나머지가 같은 실행끼리 평균)
+static void print_best(const Sweep *sweep) {
+    long long seeds = sweep->counts[PARAM_SEED];
+    long long per_policy = sweep->total / sweep->num_policies;
+
+    for (int p = 0; p < sweep->num_policies; p++) {
+        long long best = -1;
+        double best_wait = 0;
+        for (long long base = p * per_policy; base < (p + 1) * per_policy; base += seeds) {
+            double wait = 0;
+            for (long long s = 0; s < seeds; s++) {
+                wait += sweep->runs[base + s].result.avg_wait_time;
+            }
+            wait /= seeds;
+            if (best == -1 || wait < best_wait) {
+                best = base;
+                best_wait = wait;
+            }
+        }
+        const SweepRun *run = &sweep->runs[best];
+        fprintf(stderr, "[스윕] %-9s 최소 평균 대기 %.2f (시드 %lld개 평균): 프로세스 %lld, 퀀텀 %lld, "
+                "에이징 간격 %lld, 증가량 %lld\n", run->policy->name, best_wait, seeds,
+                run->params[PARAM_PROCESSES], run->params[PARAM_QUANTUM],
+                run->params[PARAM_AGING_INTERVAL], run->params[PARAM_AGING_AMOUNT]);
+    }
+}
+
+static double elapsed_ms(const struct timespec *begin, const struct timespec *end) {
+    return (end->tv_sec - begin->tv_sec) * 1e3 + (end->tv_nsec - begin->tv_nsec) / 1e6;
+}
+
+static void print_usage(const char *prog) {
+    fprintf(stderr, "사용법: %s [-p 정책[,정책...]|all] [-n 범위] [-q 범위] [-a 범위] [-A 범위] [-s 범위] "
+                    "[-b 최대 CPU 버스트] [-j 스레드 수] [-f csv|json] [-o 출력 파일]\n", prog);
+    fprintf(stderr, "범위: 시작[:끝[:간격]] (예: -q 1:10, -s 1:1000, -a 5:50:5)\n");
+    fprintf(stderr, "정책:");
+    for (int k = 0; k < num_registered_policies; k++) {
+        fprintf(stderr, " %s", registered_policies[k]->name);
+    }
+    fprintf(stderr, "\n");
+}
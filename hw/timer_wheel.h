@@ -0,0 +1,144 @@
+#ifndef TIMER_WHEEL_H
+#define TIMER_WHEEL_H
+
+#include <limits.h>
+
+// 해시 타이밍 휠: I/O 완료 시간(wake_time)을 슬롯 (wake_time % TW_SLOTS)에 연결
+// 매 틱마다 현재 슬롯만 확인하므로 잠든 프로세스 수와 관계없이 깨어날 프로세스만 처리
+// TW_SLOTS보다 먼 완료 시간은 같은 슬롯에 남아 있다가 해당 바퀴에서 처리됨
+// 슬롯마다 가장 이른 완료 시간을 유지해 다음 완료 시점 조회는 잠든 프로세스 수와 관계없이 O(TW_SLOTS)
+#define TW_SLOTS 64             // 2의 거듭제곱
+#define TW_MASK (TW_SLOTS - 1)
+
+// next/prev/wake_time은 프로세스 수만큼의 배열로, 호출자가 할당해 연결 (PCB 저장소의 열)
+typedef struct {
+    int head[TW_SLOTS];         // 슬롯별 첫 프로세스 (-1 = 비어있음)
+    int min_wake[TW_SLOTS];     // 슬롯별 가장 이른 완료 시간 (INT_MAX = 비어있음)
+    int *next;                  // 같은 슬롯의 다음 프로세스
+    int *prev;                  // 같은 슬롯의 이전 프로세스
+    int *wake_time;             // 프로세스별 I/O 완료 시간
+    int count;                  // 휠에 있는 프로세스 수
+} TimerWheel;
+
+static inline void tw_init(TimerWheel *tw) {
+    for (int slot = 0; slot < TW_SLOTS; slot++) {
+        tw->head[slot] = -1;
+        tw->min_wake[slot] = INT_MAX;
+    }
+    tw->count = 0;
+}
+
+// wake_time에 깨어나도록 등록
+static inline void tw_add(TimerWheel *tw, int index, int wake_time) {
+    int slot = wake_time & TW_MASK;
+
+    tw->wake_time[index] = wake_time;
+    tw->prev[index] = -1;
+    tw->next[index] = tw->head[slot];
+    if (tw->head[slot] != -1) {
+        tw->prev[tw->head[slot]] = index;
+    }
+    tw->head[slot] = index;
+    if (wake_time < tw->min_wake[slot]) {
+        tw->min_wake[slot] = wake_time;
+    }
+    tw->count++;
+}
+
+// 슬롯 연결에서만 뺌 (min_wake는 호출자가 갱신)
+static inline void tw_unlink(TimerWheel *tw, int index) {
+    int slot = tw->wake_time[index] & TW_MASK;
+
+    if (tw->prev[index] != -1) {
+        tw->next[tw->prev[index]] = tw->next[index];
+    } else {
+        tw->head[slot] = tw->next[index];
+    }
+    if (tw->next[index] != -1) {
+        tw->prev[tw->next[index]] = tw->prev[index];
+    }
+    tw->count--;
+}
+
+// 완료 전에 뺌 (외부 종료처럼 드문 경로라 슬롯을 다시 훑어 최소값을 맞춤)
+static inline void tw_remove(TimerWheel *tw, int index) {
+    int slot = tw->wake_time[index] & TW_MASK;
+
+    tw_unlink(tw, index);
+    tw->min_wake[slot] = INT_MAX;
+    for (int i = tw->head[slot]; i != -1; i = tw->next[i]) {
+        if (tw->wake_time[i] < tw->min_wake[slot]) {
+            tw->min_wake[slot] = tw->wake_time[i];
+        }
+    }
+}
+
+// 인덱스 배열 오름차순 정렬 (힙 정렬: 틱 처리 중 malloc 없이 O(n log n))
+static inline void sift_down(int *a, int root, int n) {
+    while (2 * root + 1 < n) {
+        int child = 2 * root + 1;
+        if (child + 1 < n && a[child + 1] > a[child]) {
+            child++;
+        }
+        if (a[root] >= a[child]) {
+            return;
+        }
+        int temp = a[root];
+        a[root] = a[child];
+        a[child] = temp;
+        root = child;
+    }
+}
+
+static inline void sort_indices(int *a, int n) {
+    for (int start = n / 2 - 1; start >= 0; start--) {
+        sift_down(a, start, n);
+    }
+    for (int end = n - 1; end > 0; end--) {
+        int temp = a[0];
+        a[0] = a[end];
+        a[end] = temp;
+        sift_down(a, 0, end);
+    }
+}
+
+// now에 깨어나는 프로세스를 휠에서 꺼내 out에 인덱스 오름차순으로 담고 개수 반환
+// (기존 PCB 순회와 같은 순서로 READY 전환하기 위해 정렬, 어차피 훑는 슬롯이므로 남은 최소값도 함께 계산)
+static inline int tw_expire(TimerWheel *tw, int now, int *out) {
+    int count = 0;
+    int slot = now & TW_MASK;
+    int index = tw->head[slot];
+    int min_wake = INT_MAX;
+
+    while (index != -1) {
+        int next = tw->next[index];
+        if (tw->wake_time[index] == now) {
+            tw_unlink(tw, index);
+            out[count++] = index;
+        } else if (tw->wake_time[index] < min_wake) {
+            min_wake = tw->wake_time[index];
+        }
+        index = next;
+    }
+    tw->min_wake[slot] = min_wake;
+    sort_indices(out, count);
+    return count;
+}
+
+// now 이후 가장 빠른 I/O 완료까지 남은 틱 수 (휠이 비어있으면 -1)
+static inline int tw_next_expiry(TimerWheel *tw, int now) {
+    if (tw->count == 0) {
+        return -1;
+    }
+
+    // 슬롯별 최소값 중 가장 이른 것 (TW_SLOTS보다 긴 대기도 같은 방법으로)
+    int earliest = INT_MAX;
+    for (int slot = 0; slot < TW_SLOTS; slot++) {
+        if (tw->min_wake[slot] < earliest) {
+            earliest = tw->min_wake[slot];
+        }
+    }
+    return earliest - now;
+}
+
+#endif
@@ -0,0 +1,333 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <string.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "gantt_log.h"
+#include "sched_trace.h"
+
+// 스케줄러의 -t 옵션으로 기록한 바이너리 트레이스를 읽어
+// 간트 차트와 프로세스별 대기/턴어라운드 시간을 다시 계산하는 오프라인 분석기
+#define MAX_PRINT_PROCESSES 50  // 표/간트 차트에 출력할 최대 프로세스 수
+#define GANTT_WIDTH 150         // 기본 출력 폭
+
+// 프로세스별 재구성 상태
+int *gantt_code;        // 현재 간트 상태 코드 (0=없음, 1=READY, 2=RUNNING, 3=SLEEP)
+int *ready_since;       // 대기 중인 READY 구간 시작 시간 (-1 = 대기 아님)
+int *wait_time;
+int *start_time;
+int *completion_time;   // -1 = 종료 안 됨
+GanttLog *gantt_logs;
+int *gantt_dirty;       // 마지막 TICK 이후 상태가 바뀐 프로세스 목록
+int *gantt_marked;
+int *executed_at;       // 마지막으로 실행한 틱 (다중 CPU면 같은 시간의 TICK 묶음을 한 번에 처리)
+int gantt_dirty_count = 0;
+int num_processes;      // PCB 슬롯 수 (열린 시스템은 종료된 슬롯을 다음 도착이 다시 씀)
+
+// 완료 통계는 EXIT마다 누적 (슬롯별 상태는 슬롯을 마지막으로 쓴 프로세스만 남으므로)
+long long total_wait_time = 0;
+long long total_turnaround_time = 0;
+int completed = 0;
+int slot_reused = 0;    // 1 = 한 슬롯을 둘 이상의 프로세스가 씀 (프로세스별 표를 출력하지 않음)
+
+long long event_counts[TRACE_TICK + 1];
+const char *event_names[TRACE_TICK + 1] = {
+    "", "CREATE", "DISPATCH", "PREEMPT", "SLEEP", "WAKE", "AGING", "EXIT", "TICK"
+};
+
+// 함수 원형
+void *checked_calloc(size_t count, size_t size);
+void set_code(int process, int code);
+void replay(const TraceEvent *events, uint64_t count);
+void print_gantt_chart(int from, int to);
+void print_statistics(const TraceHeader *header);
+
+int main(int argc, char *argv[]) {
+    int gantt_from = 1, gantt_to = -1;
+    int opt;
+
+    // 명령행 옵션: -g 간트 차트 시간 창
+    while ((opt = getopt(argc, argv, "g:")) != -1) {
+        switch (opt) {
+            case 'g':
+                if (sscanf(optarg, "%d:%d", &gantt_from, &gantt_to) < 1 || gantt_from < 1) {
+                    fprintf(stderr, "간트 차트 범위는 시작[:끝] 형식 (시작 >= 1)이어야 합니다.\n");
+                    exit(1);
+                }
+                break;
+            default:
+                fprintf(stderr, "사용법: %s [-g 시작[:끝]] 트레이스파일\n", argv[0]);
+                exit(1);
+        }
+    }
+    if (optind >= argc) {
+        fprintf(stderr, "사용법: %s [-g 시작[:끝]] 트레이스파일\n", argv[0]);
+        exit(1);
+    }
+
+    // 트레이스 파일 매핑
+    int fd = open(argv[optind], O_RDONLY);
+    if (fd == -1) {
+        perror("트레이스 파일 열기 실패");
+        exit(1);
+    }
+    struct stat st;
+    fstat(fd, &st);
+    if ((size_t)st.st_size < sizeof(TraceHeader)) {
+        fprintf(stderr, "트레이스 파일이 너무 작습니다.\n");
+        exit(1);
+    }
+    char *map = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (map == MAP_FAILED) {
+        perror("트레이스 파일 mmap 실패");
+        exit(1);
+    }
+
+    const TraceHeader *header = (const TraceHeader *)map;
+    if (memcmp(header->magic, TRACE_MAGIC, sizeof(TRACE_MAGIC)) != 0) {
+        fprintf(stderr, "트레이스 파일 형식이 아닙니다.\n");
+        exit(1);
+    }
+    uint64_t count = header->event_count;
+    if (sizeof(TraceHeader) + count * sizeof(TraceEvent) > (size_t)st.st_size) {
+        fprintf(stderr, "트레이스 파일이 잘렸습니다 (레코드 %llu개 기대).\n", (unsigned long long)count);
+        exit(1);
+    }
+
+    printf("\n=== 트레이스 분석 ===\n");
+    printf("스케줄링 알고리즘: %.16s\n", header->policy);
+    printf("프로세스 수: %d\n", header->num_processes);
+    if (header->num_cpus > 1) {
+        printf("CPU 수: %d\n", header->num_cpus);
+    }
+    printf("이벤트 수: %llu (버림: %llu)\n",
+           (unsigned long long)count, (unsigned long long)header->dropped);
+    if (header->dropped > 0) {
+        printf("※ 버려진 이벤트가 있어 결과가 실제 실행과 다를 수 있습니다.\n");
+    }
+
+    num_processes = header->num_processes;
+    gantt_code = checked_calloc(num_processes, sizeof(int));
+    ready_since = checked_calloc(num_processes, sizeof(int));
+    wait_time = checked_calloc(num_processes, sizeof(int));
+    start_time = checked_calloc(num_processes, sizeof(int));
+    completion_time = checked_calloc(num_processes, sizeof(int));
+    gantt_logs = checked_calloc(num_processes, sizeof(GanttLog));
+    gantt_dirty = checked_calloc(num_processes, sizeof(int));
+    gantt_marked = checked_calloc(num_processes, sizeof(int));
+    executed_at = checked_calloc(num_processes, sizeof(int));
+    for (int i = 0; i < num_processes; i++) {
+        executed_at[i] = -1;
+        ready_since[i] = -1;
+        start_time[i] = -1;
+        completion_time[i] = -1;
+    }
+
+    replay((const TraceEvent *)(map + sizeof(TraceHeader)), count);
+
+    // 이벤트 종류별 개수
+    printf("\n이벤트 종류별 개수:\n");
+    for (int type = TRACE_CREATE; type <= TRACE_TICK; type++) {
+        if (event_counts[type] > 0) {
+            printf("  %-13s %lld\n", event_names[type], event_counts[type]);
+        }
+    }
+
+    int to = gantt_to != -1 ? gantt_to : gantt_from + GANTT_WIDTH - 1;
+    if (to > header->end_time) to = header->end_time;
+    print_gantt_chart(gantt_from, to);
+    print_statistics(header);
+
+    munmap(map, st.st_size);
+    close(fd);
+    return 0;
+}
+
+void *checked_calloc(size_t count, size_t size) {
+    void *p = calloc(count > 0 ? count : 1, size);
+    if (p == NULL) {
+        perror("메모리 할당 실패");
+        exit(1);
+    }
+    return p;
+}
+
+// 간트 상태 변경 (다음 TICK에서 기록할 프로세스로 표시)
+void set_code(int process, int code) {
+    gantt_code[process] = code;
+    if (!gantt_marked[process]) {
+        gantt_marked[process] = 1;
+        gantt_dirty[gantt_dirty_count++] = process;
+    }
+}
+
+// 이벤트를 순서대로 적용해 상태, 대기 시간, 간트 로그를 재구성
+// (대기 시간 = READY 진입부터 디스패치까지, 스케줄러의 틱별 누적과 같은 값)
+void replay(const TraceEvent *events, uint64_t count) {
+    for (uint64_t k = 0; k < count; k++) {
+        const TraceEvent *ev = &events[k];
+        int p = ev->process;
+
+        if (ev->type < TRACE_CREATE || ev->type > TRACE_TICK ||
+            (ev->type != TRACE_TICK && (p < 0 || p >= num_processes))) {
+            fprintf(stderr, "잘못된 레코드 #%llu (종류 %d, 프로세스 %d)\n",
+                    (unsigned long long)k, ev->type, p);
+            continue;
+        }
+        event_counts[ev->type]++;
+
+        switch (ev->type) {
+            case TRACE_CREATE:
+                if (start_time[p] != -1) {
+                    slot_reused = 1;
+                }
+                start_time[p] = ev->time;
+                ready_since[p] = ev->time;
+                wait_time[p] = 0;
+                completion_time[p] = -1;
+                set_code(p, 1);
+                break;
+            case TRACE_DISPATCH:
+                if (ready_since[p] != -1) {
+                    wait_time[p] += ev->time - ready_since[p];
+                    ready_since[p] = -1;
+                }
+                set_code(p, 2);
+                break;
+            case TRACE_PREEMPT:
+            case TRACE_WAKE:
+                ready_since[p] = ev->time;
+                set_code(p, 1);
+                break;
+            case TRACE_SLEEP:
+                set_code(p, 3);
+                break;
+            case TRACE_EXIT:
+                completion_time[p] = ev->time;
+                total_wait_time += wait_time[p];
+                total_turnaround_time += ev->time - start_time[p];
+                completed++;
+                set_code(p, 0);
+                break;
+            case TRACE_TICK: {
+                // 같은 시간의 TICK(CPU마다 하나)을 묶어 이번 틱에 실행한 프로세스를 모두 표시
+                uint64_t end = k + 1;
+                while (end < count && events[end].type == TRACE_TICK && events[end].time == ev->time) {
+                    end++;
+                }
+                event_counts[TRACE_TICK] += end - k - 1;
+                for (uint64_t e = k; e < end; e++) {
+                    int q = events[e].process;
+                    if (q >= 0 && q < num_processes) {
+                        executed_at[q] = ev->time;
+                    }
+                }
+
+                // 틱 끝에 막 디스패치된 프로세스는 아직 실행 전이므로 READY로 기록하고 다음 TICK에 다시 기록
+                int kept = 0;
+                for (int d = 0; d < gantt_dirty_count; d++) {
+                    int q = gantt_dirty[d];
+                    if (gantt_code[q] == 2 && executed_at[q] != ev->time) {
+                        gl_record(&gantt_logs[q], ev->time, 1);
+                        gantt_dirty[kept++] = q;
+                        continue;
+                    }
+                    gantt_marked[q] = 0;
+                    gl_record(&gantt_logs[q], ev->time, gantt_code[q]);
+                }
+                gantt_dirty_count = kept;
+                for (uint64_t e = k; e < end; e++) {
+                    int q = events[e].process;
+                    if (q >= 0 && q < num_processes) {
+                        // 이번 틱에 실행한 프로세스: RUNNING으로 기록하고 다음 틱에 실제 상태로 다시 기록
+                        gl_record(&gantt_logs[q], ev->time, 2);
+                        set_code(q, gantt_code[q]);
+                    }
+                }
+                k = end - 1;
+                break;
+            }
+            default:
+                break;
+        }
+    }
+}
+
+void print_gantt_chart(int from, int to) {
+    printf("\n=== 간트 차트 (트레이스 재구성) ===\n\n");
+
+    // 시간 헤더
+    printf("시간: ");
+    for (int t = from - 1; t <= to; t += 10) {
+        printf("%-10d", t);
+    }
+    printf("\n");
+
+    // 눈금자
+    printf("      ");
+    for (int t = from; t <= to; t++) {
+        if (t % 10 == 0) {
+            printf("|");
+        } else if (t % 5 == 0) {
+            printf("+");
+        } else {
+            printf("-");
+        }
+    }
+    printf("\n");
+
+    // 각 프로세스별 타임라인
+    int *codes = checked_calloc(to >= from ? to - from + 1 : 1, sizeof(int));
+    for (int p = 0; p < num_processes && p < MAX_PRINT_PROCESSES; p++) {
+        printf("P%-4d ", p);
+        gl_query(&gantt_logs[p], from, to, codes);
+        for (int t = from; t <= to; t++) {
+            switch (codes[t - from]) {
+                case 1:  printf("·"); break;  // READY
+                case 2:  printf("█"); break;  // RUNNING
+                case 3:  printf("░"); break;  // SLEEP
+                default: printf(" "); break;  // DONE 또는 시작 전
+            }
+        }
+        printf("\n");
+    }
+    free(codes);
+    if (num_processes > MAX_PRINT_PROCESSES) {
+        printf("... (외 %d개 프로세스 생략)\n", num_processes - MAX_PRINT_PROCESSES);
+    }
+
+    // 범례
+    printf("\n범례:  █ = RUNNING   ░ = SLEEP   · = READY\n");
+}
+
+void print_statistics(const TraceHeader *header) {
+    printf("\n=== 최종 통계 (트레이스 재구성) ===\n");
+    if (header->time_quantum > 0) {
+        printf("사용된 타임 퀀텀: %d\n", header->time_quantum);
+    }
+    printf("총 시뮬레이션 시간: %d\n", header->end_time);
+
+    // 프로세스별 표는 슬롯을 다시 쓰지 않은 (닫힌 시스템) 트레이스만
+    for (int i = 0; !slot_reused && i < num_processes && i < MAX_PRINT_PROCESSES; i++) {
+        if (completion_time[i] != -1) {
+            printf("프로세스 %d - 대기 시간: %d, 턴어라운드: %d\n",
+                   i, wait_time[i], completion_time[i] - start_time[i]);
+        }
+    }
+    printf("완료: %d/%lld\n", completed, event_counts[TRACE_CREATE]);
+    if (slot_reused) {
+        printf("PCB 슬롯: %d개\n", num_processes);
+    }
+
+    if (completed > 0) {
+        double avg_wait_time = (double)total_wait_time / completed;
+        double avg_turnaround = (double)total_turnaround_time / completed;
+        printf("\n평균 대기 시간: %.2f time units\n", avg_wait_time);
+        printf("평균 턴어라운드 시간: %.2f time units\n", avg_turnaround);
+    }
+
+    printf("=================\n");
+}